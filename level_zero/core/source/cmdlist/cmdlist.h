@@ -346,6 +346,10 @@ struct CommandList : _ze_command_list_handle_t {
         return this->partitionCount;
     }
 
+    uint64_t getElidedInOrderWaitsCount() const {
+        return this->elidedInOrderWaitsCount;
+    }
+
     bool isImmediateType() const {
         return (this->cmdListType == CommandListType::typeImmediate);
     }
@@ -443,6 +447,7 @@ struct CommandList : _ze_command_list_handle_t {
     int64_t currentBindingTablePoolBaseAddress = NEO::StreamProperty64::initValue;
 
     uint64_t currentScratchPatchAddress = 0;
+    uint64_t elidedInOrderWaitsCount = 0;
 
     ze_context_handle_t hContext = nullptr;
     CommandQueue *cmdQImmediate = nullptr;
@@ -465,6 +470,7 @@ struct CommandList : _ze_command_list_handle_t {
     CommandListType cmdListType = CommandListType::typeRegular;
     uint32_t partitionCount = 1;
     uint32_t defaultMocsIndex = 0;
+    uint32_t coalescedFlushCountLimit = 0;
     int32_t defaultPipelinedThreadArbitrationPolicy = NEO::ThreadArbitrationPolicy::NotPresent;
 
     bool isFlushTaskSubmissionEnabled = false;
@@ -2506,7 +2506,8 @@ inline uint32_t CommandListCoreFamily<gfxCoreFamily>::getRegionOffsetForAppendMe
 template <GFXCORE_FAMILY gfxCoreFamily>
 bool CommandListCoreFamily<gfxCoreFamily>::handleInOrderImplicitDependencies(bool relaxedOrderingAllowed, bool copyOffloadOperation) {
     if (hasInOrderDependencies()) {
-        if (inOrderExecInfo->isCounterAlreadyDone(inOrderExecInfo->getCounterValue())) {
+        if (inOrderExecInfo->isCounterAlreadyDone(inOrderExecInfo->getCounterValue()) ||
+            isInOrderWaitSatisfiedOnHost(*inOrderExecInfo, inOrderExecInfo->getCounterValue(), inOrderExecInfo->getAllocationOffset())) {
             return false;
         }
 
@@ -2736,6 +2737,21 @@ bool CommandListCoreFamily<gfxCoreFamily>::canSkipInOrderEventWait(Event &event,
     return false;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamily<gfxCoreFamily>::isInOrderWaitSatisfiedOnHost(NEO::InOrderExecInfo &inOrderExecInfo, uint64_t waitValue, uint32_t offset) {
+    // Regular CmdList is replayed with patched wait values, only Immediate CmdList can rely on current counter state
+    if (!isImmediateType() || NEO::debugManager.flags.SkipSatisfiedInOrderWaits.get() != 1) {
+        return false;
+    }
+
+    if (!inOrderExecInfo.isCounterReachedOnHost(waitValue, offset, device->getL0GfxCoreHelper().getImmediateWritePostSyncOffset())) {
+        return false;
+    }
+
+    this->elidedInOrderWaitsCount++;
+    return true;
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendWaitOnEvents(uint32_t numEvents, ze_event_handle_t *phEvent, CommandToPatchContainer *outWaitCmds,
                                                                      bool relaxedOrderingAllowed, bool trackDependencies, bool apiRequest, bool skipAddingWaitEventsToResidency, bool skipFlush, bool copyOffloadOperation) {
@@ -2790,6 +2806,10 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendWaitOnEvents(uint32_t nu
             // 2. Immediate CmdList takes current value (with submission counter)
             auto waitValue = !isImmediateType() ? event->getInOrderExecBaseSignalValue() : event->getInOrderExecSignalValueWithSubmissionCounter();
 
+            if (isInOrderWaitSatisfiedOnHost(*event->getInOrderExecInfo(), waitValue, event->getInOrderAllocationOffset())) {
+                continue;
+            }
+
             CommandListCoreFamily<gfxCoreFamily>::appendWaitOnInOrderDependency(event->getInOrderExecInfo(), outWaitCmds,
                                                                                 waitValue, event->getInOrderAllocationOffset(),
                                                                                 relaxedOrderingAllowed, false, skipAddingWaitEventsToResidency,
@@ -14,6 +14,7 @@
 
 #include <atomic>
 #include <functional>
+#include <mutex>
 
 namespace NEO {
 struct SvmAllocationData;
@@ -204,6 +205,8 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     void updateDispatchFlagsWithRequiredStreamState(NEO::DispatchFlags &dispatchFlags);
 
     MOCKABLE_VIRTUAL ze_result_t flushImmediate(ze_result_t inputRet, bool performMigration, bool hasStallingCmds, bool hasRelaxedOrderingDependencies, bool kernelOperation, bool copyOffloadSubmission, ze_event_handle_t hSignalEvent, bool requireTaskCountUpdate);
+    ze_result_t flushCoalescedSubmission() override;
+    bool isFlushCoalescingAllowed(ze_event_handle_t hSignalEvent, bool hasRelaxedOrderingDependencies, bool copyOffloadSubmission, bool requireTaskCountUpdate) const;
 
     bool preferCopyThroughLockedPtr(CpuMemCopyInfo &cpuMemCopyInfo, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents);
     bool isSuitableUSMHostAlloc(NEO::SvmAllocationData *alloc);
@@ -232,12 +235,19 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     CommandQueue *getCmdQImmediate(bool copyOffloadOperation) const;
 
     MOCKABLE_VIRTUAL void checkAssert();
+    void clearCoalescedSubmission();
+    std::unique_lock<std::recursive_mutex> obtainCoalescedSubmissionLock();
     ComputeFlushMethodType computeFlushMethod = nullptr;
     uint64_t relaxedOrderingCounter = 0;
+    uint32_t coalescedAppendCount = 0;
     std::atomic<bool> dependenciesPresent{false};
+    std::recursive_mutex coalescedSubmissionMutex;
     bool latestFlushIsHostVisible = false;
     bool latestFlushIsCopyOffload = false;
     bool keepRelaxedOrderingEnabled = false;
+    bool coalescedPerformMigration = false;
+    bool coalescedHasStallingCmds = false;
+    bool coalescedKernelOperation = false;
 };
 
 template <PRODUCT_FAMILY gfxProductFamily>
@@ -24,6 +24,7 @@
 #include "level_zero/core/source/cmdqueue/cmdqueue.h"
 #include "level_zero/core/source/device/device.h"
 #include "level_zero/core/source/device/device_imp.h"
+#include "level_zero/core/source/driver/driver_handle_imp.h"
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 #include "level_zero/core/source/helpers/properties_parser.h"
 #include "level_zero/tools/source/metrics/metric.h"
@@ -49,7 +50,12 @@ ze_result_t CommandListImp::destroy() {
         static_cast<DeviceImp *>(this->device)->bcsSplit.releaseResources();
     }
 
+    if (this->coalescedFlushCountLimit > 0) {
+        static_cast<DriverHandleImp *>(this->device->getDriverHandle())->unregisterCoalescingCmdList(this);
+    }
+
     if (isImmediateType() && this->isFlushTaskSubmissionEnabled && !this->isSyncModeQueue) {
+        flushCoalescedSubmission();
         auto timeoutMicroseconds = NEO::TimeoutControls::maxTimeout;
         getCsr(false)->waitForCompletionWithTimeout(NEO::WaitParams{false, false, false, timeoutMicroseconds}, getCsr(false)->peekTaskCount());
     }
@@ -260,6 +266,13 @@ CommandList *CommandList::createImmediate(uint32_t productFamily, Device *device
 
         commandList->copyThroughLockedPtrEnabled = gfxCoreHelper.copyThroughLockedPtrEnabled(hwInfo, device->getProductHelper());
 
+        // Coalescing is limited to submissions that do not carry per-append stream state
+        if (NEO::debugManager.flags.ImmediateCmdListCoalesceFlushCount.get() > 1 && commandList->isFlushTaskSubmissionEnabled && !commandList->isSyncModeQueue &&
+            !commandList->isBcsSplitNeeded && (commandList->isCopyOnly(false) || commandList->isHeaplessStateInitEnabled())) {
+            commandList->coalescedFlushCountLimit = static_cast<uint32_t>(NEO::debugManager.flags.ImmediateCmdListCoalesceFlushCount.get());
+            static_cast<DriverHandleImp *>(device->getDriverHandle())->registerCoalescingCmdList(commandList);
+        }
+
         if ((NEO::debugManager.flags.ForceCopyOperationOffloadForComputeCmdList.get() == 1 || queueProperties.copyOffloadHint) && !commandList->isCopyOnly(false) && commandList->isInOrderExecutionEnabled()) {
             commandList->enableCopyOperationOffload(productFamily, device, desc);
         }
@@ -48,6 +48,7 @@ struct CommandListImp : public CommandList {
     NEO::SynchronizedDispatchMode getSynchronizedDispatchMode() const { return synchronizedDispatchMode; }
     void enableCopyOperationOffload(uint32_t productFamily, Device *device, const ze_command_queue_desc_t *desc);
     void setInterruptEventsCsr(NEO::CommandStreamReceiver &csr);
+    virtual ze_result_t flushCoalescedSubmission() { return ZE_RESULT_SUCCESS; }
 
   protected:
     std::shared_ptr<NEO::InOrderExecInfo> inOrderExecInfo;
@@ -428,6 +428,8 @@ ze_result_t ContextImp::freeMem(const void *ptr, bool blocking) {
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
 
+    this->driverHandle->flushCoalescedSubmissions();
+
     std::map<uint64_t, IpcHandleTracking *>::iterator ipcHandleIterator;
     auto lockIPC = this->driverHandle->lockIPCHandleMap();
     ipcHandleIterator = this->driverHandle->getIPCHandleMap().begin();
@@ -478,6 +480,9 @@ ze_result_t ContextImp::freeMemExt(const ze_memory_free_ext_desc_t *pMemFreeDesc
             return ZE_RESULT_ERROR_INVALID_ARGUMENT;
         }
 
+        // deferred free checks task counts, appends not submitted yet must be flushed to get them
+        this->driverHandle->flushCoalescedSubmissions();
+
         for (auto &pairDevice : this->devices) {
             this->freePeerAllocations(ptr, false, Device::fromHandle(pairDevice.second));
         }
@@ -26,6 +26,7 @@
 #include "shared/source/utilities/logger.h"
 
 #include "level_zero/core/source/builtin/builtin_functions_lib.h"
+#include "level_zero/core/source/cmdlist/cmdlist_imp.h"
 #include "level_zero/core/source/context/context_imp.h"
 #include "level_zero/core/source/device/device_imp.h"
 #include "level_zero/core/source/driver/driver_imp.h"
@@ -39,6 +40,7 @@
 
 #include "driver_version.h"
 
+#include <algorithm>
 #include <cstdarg>
 #include <cstdlib>
 #include <cstring>
@@ -975,6 +977,32 @@ uint32_t DriverHandleImp::getEventMaxKernelCount(uint32_t numDevices, ze_device_
     return maxCount;
 }
 
+void DriverHandleImp::registerCoalescingCmdList(CommandList *cmdList) {
+    std::lock_guard<std::mutex> lock(this->coalescingCmdListsMutex);
+    this->coalescingCmdLists.push_back(cmdList);
+}
+
+void DriverHandleImp::unregisterCoalescingCmdList(CommandList *cmdList) {
+    std::lock_guard<std::mutex> lock(this->coalescingCmdListsMutex);
+    auto &cmdLists = this->coalescingCmdLists;
+    cmdLists.erase(std::remove(cmdLists.begin(), cmdLists.end(), cmdList), cmdLists.end());
+}
+
+ze_result_t DriverHandleImp::flushCoalescedSubmissions() {
+    // Lists are flushed under their own lock, so appends in progress on other threads complete first.
+    // Registry lock is kept to prevent command list destruction during flush.
+    std::lock_guard<std::mutex> lock(this->coalescingCmdListsMutex);
+
+    ze_result_t ret = ZE_RESULT_SUCCESS;
+    for (auto cmdList : this->coalescingCmdLists) {
+        auto flushRet = static_cast<CommandListImp *>(cmdList)->flushCoalescedSubmission();
+        if (flushRet != ZE_RESULT_SUCCESS) {
+            ret = flushRet;
+        }
+    }
+    return ret;
+}
+
 int DriverHandleImp::setErrorDescription(const std::string &str) {
     return this->devices[0]->getNEODevice()->getExecutionEnvironment()->setErrorDescription(str);
 }
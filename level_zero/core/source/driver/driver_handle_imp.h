@@ -22,6 +22,7 @@
 
 namespace L0 {
 class HostPointerManager;
+struct CommandList;
 struct FabricVertex;
 struct FabricEdge;
 struct Image;
@@ -125,6 +126,10 @@ struct DriverHandleImp : public DriverHandle {
     [[nodiscard]] std::unique_lock<std::mutex> lockIPCHandleMap() { return std::unique_lock<std::mutex>(this->ipcHandleMapMutex); };
     void initHostUsmAllocPool();
 
+    void registerCoalescingCmdList(CommandList *cmdList);
+    void unregisterCoalescingCmdList(CommandList *cmdList);
+    ze_result_t flushCoalescedSubmissions();
+
     std::unique_ptr<HostPointerManager> hostPointerManager;
 
     std::mutex sharedMakeResidentAllocationsLock;
@@ -158,6 +163,10 @@ struct DriverHandleImp : public DriverHandle {
     std::map<uint64_t, IpcHandleTracking *> ipcHandles;
     std::mutex ipcHandleMapMutex;
 
+    // Immediate command lists that may hold appends not yet submitted
+    std::vector<CommandList *> coalescingCmdLists;
+    std::mutex coalescingCmdListsMutex;
+
     RootDeviceIndicesContainer rootDeviceIndices;
     std::map<uint32_t, NEO::DeviceBitfield> deviceBitfields;
     void updateRootDeviceBitFields(std::unique_ptr<NEO::Device> &neoDevice);
@@ -163,6 +163,11 @@ EventPool::~EventPool() {
 }
 
 ze_result_t EventPool::destroy() {
+    // events of the pool may be used by appends not submitted yet
+    if (auto driverHandle = devices.empty() ? nullptr : static_cast<DriverHandleImp *>(getDevice()->getDriverHandle())) {
+        driverHandle->flushCoalescedSubmissions();
+    }
+
     delete this;
 
     return ZE_RESULT_SUCCESS;
@@ -20,6 +20,7 @@
 
 #include <map>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 namespace NEO {
@@ -113,8 +114,8 @@ class L0GfxCoreHelper : public NEO::ApiGfxCoreHelper {
     virtual void appendPlatformSpecificExtensions(std::vector<std::pair<std::string, uint32_t>> &extensions, const NEO::ProductHelper &productHelper, const NEO::HardwareInfo &hwInfo) const = 0;
     virtual std::vector<std::pair<const char *, const char *>> getStallSamplingReportMetrics() const = 0;
     virtual void stallSumIpDataToTypedValues(uint64_t ip, void *sumIpData, std::vector<zet_typed_value_t> &ipDataValues) = 0;
-    virtual bool stallIpDataMapUpdate(std::map<uint64_t, void *> &stallSumIpDataMap, const uint8_t *pRawIpData) = 0;
-    virtual void stallIpDataMapDelete(std::map<uint64_t, void *> &stallSumIpDataMap) = 0;
+    virtual bool stallIpDataMapUpdate(std::unordered_map<uint64_t, void *> &stallSumIpDataMap, const uint8_t *pRawIpData) = 0;
+    virtual void stallIpDataMapDelete(std::unordered_map<uint64_t, void *> &stallSumIpDataMap) = 0;
     virtual uint32_t getIpSamplingMetricCount() = 0;
     virtual bool synchronizedDispatchSupported() const = 0;
     virtual bool implicitSynchronizedDispatchForCooperativeKernelsAllowed() const = 0;
@@ -167,8 +168,8 @@ class L0GfxCoreHelperHw : public L0GfxCoreHelper {
     void appendPlatformSpecificExtensions(std::vector<std::pair<std::string, uint32_t>> &extensions, const NEO::ProductHelper &productHelper, const NEO::HardwareInfo &hwInfo) const override;
     std::vector<std::pair<const char *, const char *>> getStallSamplingReportMetrics() const override;
     void stallSumIpDataToTypedValues(uint64_t ip, void *sumIpData, std::vector<zet_typed_value_t> &ipDataValues) override;
-    bool stallIpDataMapUpdate(std::map<uint64_t, void *> &stallSumIpDataMap, const uint8_t *pRawIpData) override;
-    void stallIpDataMapDelete(std::map<uint64_t, void *> &stallSumIpDataMap) override;
+    bool stallIpDataMapUpdate(std::unordered_map<uint64_t, void *> &stallSumIpDataMap, const uint8_t *pRawIpData) override;
+    void stallIpDataMapDelete(std::unordered_map<uint64_t, void *> &stallSumIpDataMap) override;
     uint32_t getIpSamplingMetricCount() override;
     bool synchronizedDispatchSupported() const override;
     bool implicitSynchronizedDispatchForCooperativeKernelsAllowed() const override;
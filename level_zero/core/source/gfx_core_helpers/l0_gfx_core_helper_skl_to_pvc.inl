@@ -10,7 +10,7 @@
 
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 
-#include <map>
+#include <unordered_map>
 
 namespace L0 {
 constexpr uint32_t ipSamplingMetricCount = 10u;
@@ -81,7 +81,7 @@ uint32_t L0GfxCoreHelperHw<Family>::getIpSamplingMetricCount() {
 }
 
 template <typename Family>
-void L0GfxCoreHelperHw<Family>::stallIpDataMapDelete(std::map<uint64_t, void *> &stallSumIpDataMap) {
+void L0GfxCoreHelperHw<Family>::stallIpDataMapDelete(std::unordered_map<uint64_t, void *> &stallSumIpDataMap) {
     for (auto i = stallSumIpDataMap.begin(); i != stallSumIpDataMap.end(); i++) {
         StallSumIpData_t *stallSumData = reinterpret_cast<StallSumIpData_t *>(i->second);
         if (stallSumData) {
@@ -92,27 +92,16 @@ void L0GfxCoreHelperHw<Family>::stallIpDataMapDelete(std::map<uint64_t, void *>
 }
 
 template <typename Family>
-bool L0GfxCoreHelperHw<Family>::stallIpDataMapUpdate(std::map<uint64_t, void *> &stallSumIpDataMap, const uint8_t *pRawIpData) {
+bool L0GfxCoreHelperHw<Family>::stallIpDataMapUpdate(std::unordered_map<uint64_t, void *> &stallSumIpDataMap, const uint8_t *pRawIpData) {
     const uint8_t *tempAddr = pRawIpData;
     uint64_t ip = 0ULL;
     memcpy_s(reinterpret_cast<uint8_t *>(&ip), sizeof(ip), tempAddr, sizeof(ip));
     ip &= 0x1fffffff;
-    StallSumIpData_t *stallSumData = nullptr;
-    if (stallSumIpDataMap.count(ip) == 0) {
-        stallSumData = new StallSumIpData_t{};
-        stallSumData->activeCount = 0;
-        stallSumData->otherCount = 0;
-        stallSumData->controlCount = 0;
-        stallSumData->pipeStallCount = 0;
-        stallSumData->sendCount = 0;
-        stallSumData->distAccCount = 0;
-        stallSumData->sbidCount = 0;
-        stallSumData->syncCount = 0;
-        stallSumData->instFetchCount = 0;
-        stallSumIpDataMap[ip] = stallSumData;
-    } else {
-        stallSumData = reinterpret_cast<StallSumIpData_t *>(stallSumIpDataMap[ip]);
+    auto &stallSumIpData = stallSumIpDataMap[ip];
+    if (stallSumIpData == nullptr) {
+        stallSumIpData = new StallSumIpData_t{};
     }
+    StallSumIpData_t *stallSumData = reinterpret_cast<StallSumIpData_t *>(stallSumIpData);
     tempAddr += ipStallSamplingOffset;
 
     auto getCount = [&tempAddr]() {
@@ -79,6 +79,7 @@ ze_result_t ImageImp::destroy() {
     if (this->getAllocation() && this->device) {
         auto imageAllocPtr = reinterpret_cast<const void *>(this->getAllocation()->getGpuAddress());
         DriverHandleImp *driverHandle = static_cast<DriverHandleImp *>(this->device->getDriverHandle());
+        driverHandle->flushCoalescedSubmissions();
 
         for (auto peerDevice : driverHandle->devices) {
             this->destroyPeerImages(imageAllocPtr, peerDevice);
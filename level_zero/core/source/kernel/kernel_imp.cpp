@@ -1215,6 +1215,10 @@ ze_result_t KernelImp::initialize(const ze_kernel_desc_t *desc) {
         this->internalResidencyContainer.push_back(rtDispatchGlobalsInfo->rtDispatchGlobalsArray);
     }
 
+    if (NEO::debugManager.flags.EnableDispatchWalkerTemplate.get() == 1) {
+        this->dispatchWalkerTemplate = std::make_unique<NEO::DispatchWalkerTemplate>();
+    }
+
     return ZE_RESULT_SUCCESS;
 }
 
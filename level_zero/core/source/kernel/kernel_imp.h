@@ -10,6 +10,7 @@
 #include "shared/source/command_stream/thread_arbitration_policy.h"
 #include "shared/source/helpers/vec.h"
 #include "shared/source/kernel/dispatch_kernel_encoder_interface.h"
+#include "shared/source/kernel/dispatch_walker_template.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/unified_memory/unified_memory.h"
 
@@ -198,6 +199,7 @@ struct KernelImp : Kernel {
     ze_result_t setSchedulingHintExp(ze_scheduling_hint_exp_desc_t *pHint) override;
 
     NEO::ImplicitArgs *getImplicitArgs() const override { return pImplicitArgs.get(); }
+    NEO::DispatchWalkerTemplate *getDispatchWalkerTemplate() const override { return dispatchWalkerTemplate.get(); }
 
     KernelExt *getExtension(uint32_t extensionType);
 
@@ -306,6 +308,8 @@ struct KernelImp : Kernel {
 
     std::unique_ptr<KernelExt> pExtension;
 
+    std::unique_ptr<NEO::DispatchWalkerTemplate> dispatchWalkerTemplate;
+
     struct SuggestGroupSizeCacheEntry {
         Vec3<size_t> groupSize;
         uint32_t slmArgsTotalSize = 0u;
@@ -1553,6 +1553,10 @@ bool ModuleImp::populateHostGlobalSymbolsMap(std::unordered_map<std::string, std
 ze_result_t ModuleImp::destroy() {
     notifyModuleDestroy();
 
+    if (auto driverHandle = static_cast<DriverHandleImp *>(device->getDriverHandle())) {
+        driverHandle->flushCoalescedSubmissions();
+    }
+
     auto tempHandle = debugModuleHandle;
     auto tempDevice = device;
 
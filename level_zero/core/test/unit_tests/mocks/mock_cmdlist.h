@@ -700,6 +700,8 @@ class MockCommandListImmediateHw : public WhiteBox<::L0::CommandListCoreFamilyIm
     using BaseClass::applyMemoryRangesBarrier;
     using BaseClass::cmdListType;
     using BaseClass::cmdQImmediate;
+    using BaseClass::coalescedAppendCount;
+    using BaseClass::coalescedFlushCountLimit;
     using BaseClass::copyThroughLockedPtrEnabled;
     using BaseClass::dcFlushSupport;
     using BaseClass::dependenciesPresent;
@@ -37,6 +37,8 @@
 
 #include "test_traits_common.h"
 
+#include <thread>
+
 namespace L0 {
 namespace ult {
 
@@ -499,6 +501,126 @@ HWTEST2_F(CommandListTest, givenImmediateCommandListWhenAppendMemoryRangesBarrie
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
+HWTEST2_F(CommandListTest, givenImmediateCommandListWithCoalescingLimitWhenAppendingWithoutSignalEventThenSubmissionsAreCoalescedUntilLimitOrExplicitFlush, MatchAny) {
+    uint32_t numRanges = 1;
+    const size_t rangeSizes = 1;
+    const char *rangesBuffer[rangeSizes];
+    const void **ranges = reinterpret_cast<const void **>(&rangesBuffer[0]);
+
+    ze_command_queue_desc_t queueDesc = {};
+    auto queue = std::make_unique<Mock<CommandQueue>>(device, device->getNEODevice()->getDefaultEngine().commandStreamReceiver, &queueDesc);
+
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.isFlushTaskSubmissionEnabled = true;
+    cmdList.cmdListType = CommandList::CommandListType::typeImmediate;
+    cmdList.cmdQImmediate = queue.get();
+    cmdList.initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+    cmdList.commandContainer.setImmediateCmdListCsr(device->getNEODevice()->getDefaultEngine().commandStreamReceiver);
+    cmdList.coalescedFlushCountLimit = 3;
+
+    auto driverHandleImp = static_cast<DriverHandleImp *>(device->getDriverHandle());
+    driverHandleImp->registerCoalescingCmdList(&cmdList);
+    EXPECT_EQ(1u, driverHandleImp->coalescingCmdLists.size());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendMemoryRangesBarrier(numRanges, &rangeSizes, ranges, nullptr, 0, nullptr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendMemoryRangesBarrier(numRanges, &rangeSizes, ranges, nullptr, 0, nullptr));
+    EXPECT_EQ(0u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(2u, cmdList.coalescedAppendCount);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendMemoryRangesBarrier(numRanges, &rangeSizes, ranges, nullptr, 0, nullptr));
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList.coalescedAppendCount);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendMemoryRangesBarrier(numRanges, &rangeSizes, ranges, nullptr, 0, nullptr));
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(1u, cmdList.coalescedAppendCount);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, driverHandleImp->flushCoalescedSubmissions());
+    EXPECT_EQ(2u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList.coalescedAppendCount);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.flushCoalescedSubmission());
+    EXPECT_EQ(2u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+
+    driverHandleImp->unregisterCoalescingCmdList(&cmdList);
+    EXPECT_EQ(0u, driverHandleImp->coalescingCmdLists.size());
+}
+
+HWTEST2_F(CommandListTest, givenImmediateCommandListWithPendingAppendsWhenMemoryIsFreedFromOtherThreadThenPendingAppendsAreSubmitted, MatchAny) {
+    uint32_t numRanges = 1;
+    const size_t rangeSizes = 1;
+    const char *rangesBuffer[rangeSizes];
+    const void **ranges = reinterpret_cast<const void **>(&rangesBuffer[0]);
+
+    ze_command_queue_desc_t queueDesc = {};
+    auto queue = std::make_unique<Mock<CommandQueue>>(device, device->getNEODevice()->getDefaultEngine().commandStreamReceiver, &queueDesc);
+
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.isFlushTaskSubmissionEnabled = true;
+    cmdList.cmdListType = CommandList::CommandListType::typeImmediate;
+    cmdList.cmdQImmediate = queue.get();
+    cmdList.initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+    cmdList.commandContainer.setImmediateCmdListCsr(device->getNEODevice()->getDefaultEngine().commandStreamReceiver);
+    cmdList.coalescedFlushCountLimit = 3;
+
+    auto driverHandleImp = static_cast<DriverHandleImp *>(device->getDriverHandle());
+    driverHandleImp->registerCoalescingCmdList(&cmdList);
+
+    void *ptr = nullptr;
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    ASSERT_EQ(ZE_RESULT_SUCCESS, context->allocHostMem(&hostDesc, MemoryConstants::pageSize, MemoryConstants::pageSize, &ptr));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendMemoryRangesBarrier(numRanges, &rangeSizes, ranges, nullptr, 0, nullptr));
+    EXPECT_EQ(1u, cmdList.coalescedAppendCount);
+
+    std::thread freeThread([&]() {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, context->freeMem(ptr, true));
+    });
+    freeThread.join();
+
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList.coalescedAppendCount);
+
+    driverHandleImp->unregisterCoalescingCmdList(&cmdList);
+}
+
+HWTEST2_F(CommandListTest, givenImmediateCommandListWithPendingAppendsWhenMemoryIsFreedWithDeferFreePolicyThenPendingAppendsAreSubmitted, MatchAny) {
+    uint32_t numRanges = 1;
+    const size_t rangeSizes = 1;
+    const char *rangesBuffer[rangeSizes];
+    const void **ranges = reinterpret_cast<const void **>(&rangesBuffer[0]);
+
+    ze_command_queue_desc_t queueDesc = {};
+    auto queue = std::make_unique<Mock<CommandQueue>>(device, device->getNEODevice()->getDefaultEngine().commandStreamReceiver, &queueDesc);
+
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.isFlushTaskSubmissionEnabled = true;
+    cmdList.cmdListType = CommandList::CommandListType::typeImmediate;
+    cmdList.cmdQImmediate = queue.get();
+    cmdList.initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+    cmdList.commandContainer.setImmediateCmdListCsr(device->getNEODevice()->getDefaultEngine().commandStreamReceiver);
+    cmdList.coalescedFlushCountLimit = 3;
+
+    auto driverHandleImp = static_cast<DriverHandleImp *>(device->getDriverHandle());
+    driverHandleImp->registerCoalescingCmdList(&cmdList);
+
+    void *ptr = nullptr;
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    ASSERT_EQ(ZE_RESULT_SUCCESS, context->allocHostMem(&hostDesc, MemoryConstants::pageSize, MemoryConstants::pageSize, &ptr));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendMemoryRangesBarrier(numRanges, &rangeSizes, ranges, nullptr, 0, nullptr));
+    EXPECT_EQ(1u, cmdList.coalescedAppendCount);
+
+    ze_memory_free_ext_desc_t memFreeDesc = {};
+    memFreeDesc.freePolicy = ZE_DRIVER_MEMORY_FREE_POLICY_EXT_FLAG_DEFER_FREE;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->freeMemExt(&memFreeDesc, ptr));
+
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList.coalescedAppendCount);
+
+    driverHandleImp->unregisterCoalescingCmdList(&cmdList);
+}
+
 HWTEST2_F(CommandListTest, givenImmediateCommandListWhenAppendMemoryRangesBarrierNotUsingFlushTaskThenExpectCorrectExecuteCall, MatchAny) {
     ze_result_t result = ZE_RESULT_SUCCESS;
     uint32_t numRanges = 1;
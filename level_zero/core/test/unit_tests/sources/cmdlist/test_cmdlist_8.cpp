@@ -25,6 +25,10 @@ extern bool getNumThreadsCalled;
 }
 } // namespace NEO
 
+namespace CpuIntrinsicsTests {
+extern std::atomic<uint32_t> sfenceCounter;
+} // namespace CpuIntrinsicsTests
+
 namespace L0 {
 namespace ult {
 
@@ -855,6 +859,34 @@ HWTEST2_F(AppendMemoryLockedCopyTest, givenImmediateCommandListAndNonUsmHostPtrW
     EXPECT_EQ(0, memcmp(lockedPtr, nonUsmHostPtr, 1024));
 }
 
+HWTEST2_F(AppendMemoryLockedCopyTest, givenImmediateCommandListAndNonUsmHostPtrWhenCopyH2DThenStreamingStoresAreUsedUnlessDisabled, MatchAny) {
+    ze_command_queue_desc_t queueDesc = {};
+    auto queue = std::make_unique<Mock<CommandQueue>>(device, device->getNEODevice()->getDefaultEngine().commandStreamReceiver, &queueDesc);
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.copyThroughLockedPtrEnabled = true;
+    cmdList.cmdQImmediate = queue.get();
+
+    cmdList.initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+
+    NEO::SvmAllocationData *allocData;
+    device->getDriverHandle()->findAllocationDataForRange(devicePtr, 1024, allocData);
+    auto dstAlloc = allocData->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+
+    memset(nonUsmHostPtr, 1, 1024);
+    auto sfenceCountBefore = CpuIntrinsicsTests::sfenceCounter.load();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendMemoryCopy(ptrOffset(devicePtr, 3), nonUsmHostPtr, 1021, nullptr, 0, nullptr, copyParams));
+    EXPECT_EQ(sfenceCountBefore + 1, CpuIntrinsicsTests::sfenceCounter.load());
+    EXPECT_EQ(0, memcmp(ptrOffset(dstAlloc->getLockedPtr(), 3), nonUsmHostPtr, 1021));
+
+    debugManager.flags.ExperimentalCopyThroughLockStreamingStores.set(0);
+    memset(nonUsmHostPtr, 2, 1024);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendMemoryCopy(devicePtr, nonUsmHostPtr, 1024, nullptr, 0, nullptr, copyParams));
+    EXPECT_EQ(sfenceCountBefore + 1, CpuIntrinsicsTests::sfenceCounter.load());
+    EXPECT_EQ(0, memcmp(dstAlloc->getLockedPtr(), nonUsmHostPtr, 1024));
+}
+
 HWTEST2_F(AppendMemoryLockedCopyTest, givenImmediateCommandListAndSignalEventAndNonUsmHostPtrWhenCopyH2DThenSignalEvent, MatchAny) {
     ze_command_queue_desc_t queueDesc = {};
     auto queue = std::make_unique<Mock<CommandQueue>>(device, device->getNEODevice()->getDefaultEngine().commandStreamReceiver, &queueDesc);
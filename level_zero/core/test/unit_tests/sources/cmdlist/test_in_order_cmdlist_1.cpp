@@ -2394,6 +2394,39 @@ HWTEST2_F(InOrderCmdListTests, givenInOrderEventModeWhenSubmittingFromDifferentC
     EXPECT_NE(immCmdList1->inOrderExecInfo->getBaseDeviceAddress(), immCmdList2->inOrderExecInfo->getBaseDeviceAddress());
 }
 
+HWTEST2_F(InOrderCmdListTests, givenSkipSatisfiedInOrderWaitsFlagAndCounterReachedOnHostWhenSubmittingFromDifferentCmdListThenDontProgramSemaphore, MatchAny) {
+    debugManager.flags.SkipSatisfiedInOrderWaits.set(1);
+
+    auto immCmdList1 = createImmCmdList<gfxCoreFamily>();
+    auto immCmdList2 = createImmCmdList<gfxCoreFamily>();
+
+    auto eventPool = createEvents<FamilyType>(1, false);
+    auto event0Handle = events[0]->toHandle();
+
+    auto cmdStream = immCmdList2->getCmdContainer().getCommandStream();
+
+    immCmdList1->appendLaunchKernel(kernel->toHandle(), groupCount, event0Handle, 0, nullptr, launchParams, false);
+
+    auto hostAddress = immCmdList1->inOrderExecInfo->getBaseHostAddress();
+    for (uint32_t i = 0; i < immCmdList1->inOrderExecInfo->getNumHostPartitionsToWait(); i++) {
+        *ptrOffset(hostAddress, i * device->getL0GfxCoreHelper().getImmediateWritePostSyncOffset()) = 1u;
+    }
+
+    auto offset = cmdStream->getUsed();
+    immCmdList2->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 1, &event0Handle, launchParams, false);
+
+    EXPECT_EQ(1u, immCmdList2->getElidedInOrderWaitsCount());
+
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::Parse::parseCommandBuffer(cmdList, ptrOffset(cmdStream->getCpuBase(), offset), cmdStream->getUsed() - offset));
+
+    auto semaphores = findAll<typename FamilyType::MI_SEMAPHORE_WAIT *>(cmdList.begin(), cmdList.end());
+    for (auto &semaphore : semaphores) {
+        auto semaphoreCmd = genCmdCast<typename FamilyType::MI_SEMAPHORE_WAIT *>(*semaphore);
+        EXPECT_NE(immCmdList1->inOrderExecInfo->getBaseDeviceAddress(), semaphoreCmd->getSemaphoreGraphicsAddress());
+    }
+}
+
 HWTEST2_F(InOrderCmdListTests, givenDebugFlagSetWhenDispatchingThenEnsureHostAllocationResidency, MatchAny) {
     NEO::debugManager.flags.InOrderDuplicatedCounterStorageEnabled.set(1);
 
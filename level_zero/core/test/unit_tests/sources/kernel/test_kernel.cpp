@@ -108,6 +108,31 @@ TEST_F(KernelInitTest, givenKernelToInitWhenItHasUnknownArgThenUnknowKernelArgHa
     EXPECT_EQ(mockKernelImmData->getDescriptor().payloadMappings.explicitArgs[0].type, NEO::ArgDescriptor::argTUnknown);
 }
 
+TEST_F(KernelInitTest, givenDispatchWalkerTemplateEnabledWhenKernelIsInitializedThenWalkerTemplateIsCreated) {
+    uint32_t perHwThreadPrivateMemorySizeRequested = 32u;
+
+    std::unique_ptr<MockImmutableData> mockKernelImmData =
+        std::make_unique<MockImmutableData>(perHwThreadPrivateMemorySizeRequested);
+
+    createModuleFromMockBinary(perHwThreadPrivateMemorySizeRequested, false, mockKernelImmData.get());
+    ze_kernel_desc_t desc = {};
+    desc.pKernelName = kernelName.c_str();
+
+    {
+        auto kernel = std::make_unique<ModuleImmutableDataFixture::MockKernel>(module.get());
+        EXPECT_EQ(ZE_RESULT_SUCCESS, kernel->initialize(&desc));
+        EXPECT_EQ(nullptr, kernel->getDispatchWalkerTemplate());
+    }
+
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.EnableDispatchWalkerTemplate.set(1);
+
+    auto kernel = std::make_unique<ModuleImmutableDataFixture::MockKernel>(module.get());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, kernel->initialize(&desc));
+    ASSERT_NE(nullptr, kernel->getDispatchWalkerTemplate());
+    EXPECT_FALSE(kernel->getDispatchWalkerTemplate()->isValid());
+}
+
 TEST_F(KernelInitTest, givenKernelToInitAndPreemptionEnabledWhenItHasUnknownArgThenUnknowKernelArgHandlerAssigned) {
     uint32_t perHwThreadPrivateMemorySizeRequested = 32u;
 
@@ -133,7 +133,7 @@ XE2_HPG_CORETEST_F(L0GfxCoreHelperTestXe2Hpg, GivenXe3pWhenCallingisThreadContro
 
 XE2_HPG_CORETEST_F(L0GfxCoreHelperTestXe2Hpg, GivenXe2HpgWhenCheckingL0HelperForDeletingIpSamplingEntryWithNullValuesThenMapRemainstheSameSize) {
     auto &l0GfxCoreHelper = getHelper<L0GfxCoreHelper>();
-    std::map<uint64_t, void *> stallSumIpDataMap;
+    std::unordered_map<uint64_t, void *> stallSumIpDataMap;
     stallSumIpDataMap.emplace(std::pair<uint64_t, void *>(0ull, nullptr));
     l0GfxCoreHelper.stallIpDataMapDelete(stallSumIpDataMap);
     EXPECT_NE(0u, stallSumIpDataMap.size());
@@ -76,18 +76,15 @@ ze_result_t LinuxFrequencyImp::osFrequencySetRange(const zes_freq_range_t *pLimi
 
     if (pSysmanKmdInterface->isDefaultFrequencyAvailable()) {
         if (newMax == -1 && newMin == -1) {
-            double maxDefault = 0, minDefault = 0;
-            ze_result_t result1, result2, result;
-            result1 = pSysfsAccess->read(maxDefaultFreqFile, maxDefault);
-            result2 = pSysfsAccess->read(minDefaultFreqFile, minDefault);
-            if (result1 == ZE_RESULT_SUCCESS && result2 == ZE_RESULT_SUCCESS) {
-                result = setMax(maxDefault);
+            std::vector<double> defaultFreqs;
+            if (pSysfsAccess->read({maxDefaultFreqFile, minDefaultFreqFile}, defaultFreqs) == ZE_RESULT_SUCCESS) {
+                ze_result_t result = setMax(defaultFreqs[0]);
                 if (ZE_RESULT_SUCCESS != result) {
                     NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr,
                                           "error@<%s> <setMax(maxDefault) returned 0x%x>\n", __func__, result);
                     return result;
                 }
-                return setMin(minDefault);
+                return setMin(defaultFreqs[1]);
             }
         }
     }
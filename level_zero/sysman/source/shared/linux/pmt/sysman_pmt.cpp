@@ -5,12 +5,16 @@
  *
  */
 
+#include "shared/source/helpers/string.h"
 #include "shared/source/os_interface/linux/pmt_util.h"
 
 #include "level_zero/sysman/source/shared/linux/product_helper/sysman_product_helper.h"
 #include "level_zero/sysman/source/shared/linux/sysman_fs_access_interface.h"
 #include "level_zero/sysman/source/shared/linux/zes_os_sysman_imp.h"
 
+#include <algorithm>
+#include <limits>
+
 namespace L0 {
 namespace Sysman {
 
@@ -75,7 +79,7 @@ bool PlatformMonitoringTech::getTelemOffsetForContainer(SysmanProductHelper *pSy
     return true;
 }
 
-bool PlatformMonitoringTech::readValue(const std::map<std::string, uint64_t> keyOffsetMap, const std::string &telemDir, const std::string &key, const uint64_t &telemOffset, uint32_t &value) {
+bool PlatformMonitoringTech::readValue(const std::map<std::string, uint64_t> &keyOffsetMap, const std::string &telemDir, const std::string &key, const uint64_t &telemOffset, uint32_t &value) {
 
     auto containerOffset = keyOffsetMap.find(key);
     if (containerOffset == keyOffsetMap.end()) {
@@ -92,7 +96,7 @@ bool PlatformMonitoringTech::readValue(const std::map<std::string, uint64_t> key
     return true;
 }
 
-bool PlatformMonitoringTech::readValue(const std::map<std::string, uint64_t> keyOffsetMap, const std::string &telemDir, const std::string &key, const uint64_t &telemOffset, uint64_t &value) {
+bool PlatformMonitoringTech::readValue(const std::map<std::string, uint64_t> &keyOffsetMap, const std::string &telemDir, const std::string &key, const uint64_t &telemOffset, uint64_t &value) {
 
     auto containerOffset = keyOffsetMap.find(key);
     if (containerOffset == keyOffsetMap.end()) {
@@ -109,6 +113,63 @@ bool PlatformMonitoringTech::readValue(const std::map<std::string, uint64_t> key
     return true;
 }
 
+bool PlatformMonitoringTech::readTelemSnapshot(const std::map<std::string, uint64_t> &keyOffsetMap, const std::string &telemDir, const std::vector<std::string> &keys, const uint64_t &telemOffset, TelemSnapshot &snapshot) {
+
+    if (keys.empty()) {
+        return false;
+    }
+
+    uint64_t minOffset = std::numeric_limits<uint64_t>::max();
+    uint64_t maxOffset = 0;
+    for (const auto &key : keys) {
+        auto containerOffset = keyOffsetMap.find(key);
+        if (containerOffset == keyOffsetMap.end()) {
+            NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Failed to find keyOffset in keyOffsetMap for %s key \n", __FUNCTION__, key.c_str());
+            return false;
+        }
+        minOffset = std::min(minOffset, containerOffset->second);
+        maxOffset = std::max(maxOffset, containerOffset->second);
+    }
+
+    // single read covering all requested keys, values are extracted from the snapshot afterwards
+    snapshot.offset = telemOffset + minOffset;
+    snapshot.data.resize(static_cast<size_t>(maxOffset - minOffset) + sizeof(uint64_t));
+    ssize_t bytesRead = NEO::PmtUtil::readTelem(telemDir.data(), snapshot.data.size(), snapshot.offset, snapshot.data.data());
+    if (bytesRead <= 0) {
+        NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Failed to read telemetry snapshot from %s \n", __FUNCTION__, telemDir.c_str());
+        snapshot.data.clear();
+        return false;
+    }
+    snapshot.data.resize(static_cast<size_t>(bytesRead));
+    return true;
+}
+
+template <typename ValueT>
+static bool readValueFromSnapshot(const PlatformMonitoringTech::TelemSnapshot &snapshot, const std::map<std::string, uint64_t> &keyOffsetMap, const std::string &key, const uint64_t &telemOffset, ValueT &value) {
+
+    auto containerOffset = keyOffsetMap.find(key);
+    if (containerOffset == keyOffsetMap.end()) {
+        NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Failed to find keyOffset in keyOffsetMap \n", __FUNCTION__);
+        return false;
+    }
+
+    uint64_t offset = telemOffset + containerOffset->second;
+    if (offset < snapshot.offset || offset - snapshot.offset + sizeof(ValueT) > snapshot.data.size()) {
+        NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Value for %s key is not present in snapshot \n", __FUNCTION__, key.c_str());
+        return false;
+    }
+    memcpy_s(&value, sizeof(ValueT), snapshot.data.data() + (offset - snapshot.offset), sizeof(ValueT));
+    return true;
+}
+
+bool PlatformMonitoringTech::readValue(const TelemSnapshot &snapshot, const std::map<std::string, uint64_t> &keyOffsetMap, const std::string &key, const uint64_t &telemOffset, uint32_t &value) {
+    return readValueFromSnapshot(snapshot, keyOffsetMap, key, telemOffset, value);
+}
+
+bool PlatformMonitoringTech::readValue(const TelemSnapshot &snapshot, const std::map<std::string, uint64_t> &keyOffsetMap, const std::string &key, const uint64_t &telemOffset, uint64_t &value) {
+    return readValueFromSnapshot(snapshot, keyOffsetMap, key, telemOffset, value);
+}
+
 bool PlatformMonitoringTech::getTelemDataForTileAggregator(const std::map<uint32_t, std::string> telemNodesInPciPath, uint32_t subdeviceId, std::string &telemDir, std::string &guid, uint64_t &telemOffset) {
 
     uint32_t rootDeviceTelemIndex = telemNodesInPciPath.begin()->first;
@@ -12,6 +12,8 @@
 #include "level_zero/zes_api.h"
 
 #include <map>
+#include <string>
+#include <vector>
 
 namespace L0 {
 namespace Sysman {
@@ -27,13 +29,21 @@ class PlatformMonitoringTech : NEO::NonCopyableOrMovableClass {
         uint64_t offset;
     };
 
+    struct TelemSnapshot {
+        uint64_t offset = 0;
+        std::vector<uint8_t> data;
+    };
+
     static bool getKeyOffsetMap(SysmanProductHelper *pSysmanProductHelper, std::string guid, std::map<std::string, uint64_t> &keyOffsetMap);
     static bool getTelemOffsetAndTelemDir(LinuxSysmanImp *pLinuxSysmanImp, uint64_t &telemOffset, std::string &telemDir);
     static bool getTelemData(const std::map<uint32_t, std::string> telemNodesInPciPath, std::string &telemDir, std::string &guid, uint64_t &telemOffset);
     static bool getTelemDataForTileAggregator(const std::map<uint32_t, std::string> telemNodesInPciPath, uint32_t subDeviceId, std::string &telemDir, std::string &guid, uint64_t &telemOffset);
     static bool getTelemOffsetForContainer(SysmanProductHelper *pSysmanProductHelper, const std::string &telemDir, const std::string &key, uint64_t &telemOffset);
-    static bool readValue(const std::map<std::string, uint64_t> keyOffsetMap, const std::string &telemDir, const std::string &key, const uint64_t &telemOffset, uint32_t &value);
-    static bool readValue(const std::map<std::string, uint64_t> keyOffsetMap, const std::string &telemDir, const std::string &key, const uint64_t &telemOffset, uint64_t &value);
+    static bool readValue(const std::map<std::string, uint64_t> &keyOffsetMap, const std::string &telemDir, const std::string &key, const uint64_t &telemOffset, uint32_t &value);
+    static bool readValue(const std::map<std::string, uint64_t> &keyOffsetMap, const std::string &telemDir, const std::string &key, const uint64_t &telemOffset, uint64_t &value);
+    static bool readTelemSnapshot(const std::map<std::string, uint64_t> &keyOffsetMap, const std::string &telemDir, const std::vector<std::string> &keys, const uint64_t &telemOffset, TelemSnapshot &snapshot);
+    static bool readValue(const TelemSnapshot &snapshot, const std::map<std::string, uint64_t> &keyOffsetMap, const std::string &key, const uint64_t &telemOffset, uint32_t &value);
+    static bool readValue(const TelemSnapshot &snapshot, const std::map<std::string, uint64_t> &keyOffsetMap, const std::string &key, const uint64_t &telemOffset, uint64_t &value);
     static bool isTelemetrySupportAvailable(LinuxSysmanImp *pLinuxSysmanImp, uint32_t subdeviceId);
 };
 
@@ -7,6 +7,8 @@
 
 #include "level_zero/sysman/source/shared/linux/pmu/sysman_pmu_imp.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/string.h"
 #include "shared/source/memory_manager/memory_manager.h"
 
 #include "level_zero/sysman/source/shared/linux/kmd_interface/sysman_kmd_interface.h"
@@ -50,15 +52,62 @@ int64_t PmuInterfaceImp::pmuInterfaceOpen(uint64_t config, int group, uint32_t f
         ret = perfEventOpen(&attr, -1, cpu++, group, 0);
     } while ((ret < 0 && getErrorNo() == EINVAL) && (cpu < nrCpus));
 
+    if (ret >= 0) {
+        // fd numbers are reused after close and group leader reads change with each new member
+        invalidateCachedSample(static_cast<int>(ret));
+        if (group >= 0) {
+            invalidateCachedSample(group);
+        }
+    }
     return ret;
 }
 
+std::chrono::steady_clock::time_point PmuInterfaceImp::getCurrentTime() {
+    return std::chrono::steady_clock::now();
+}
+
+bool PmuInterfaceImp::getCachedSample(int fd, uint64_t *data, ssize_t sizeOfdata, std::chrono::microseconds cacheWindow) {
+    std::lock_guard<std::mutex> lock(sampleCacheMutex);
+    auto sample = sampleCache.find(fd);
+    if (sample == sampleCache.end() || sample->second.data.size() * sizeof(uint64_t) != static_cast<size_t>(sizeOfdata)) {
+        return false;
+    }
+    if (getCurrentTime() - sample->second.readTime > cacheWindow) {
+        return false;
+    }
+    memcpy_s(data, sizeOfdata, sample->second.data.data(), sizeOfdata);
+    return true;
+}
+
+void PmuInterfaceImp::storeSample(int fd, const uint64_t *data, ssize_t sizeOfdata) {
+    std::lock_guard<std::mutex> lock(sampleCacheMutex);
+    auto &sample = sampleCache[fd];
+    sample.readTime = getCurrentTime();
+    sample.data.assign(data, data + sizeOfdata / sizeof(uint64_t));
+}
+
+void PmuInterfaceImp::invalidateCachedSample(int fd) {
+    std::lock_guard<std::mutex> lock(sampleCacheMutex);
+    sampleCache.erase(fd);
+}
+
 int PmuInterfaceImp::pmuRead(int fd, uint64_t *data, ssize_t sizeOfdata) {
+    // samples of the same counters requested by several clients in a short window are served from cache
+    const auto cacheWindowUs = NEO::debugManager.flags.SysmanPmuSampleCacheWindowUs.get();
+    const bool sampleCacheEnabled = cacheWindowUs > 0 && sizeOfdata % sizeof(uint64_t) == 0;
+    if (sampleCacheEnabled && getCachedSample(fd, data, sizeOfdata, std::chrono::microseconds(cacheWindowUs))) {
+        return 0;
+    }
+
     ssize_t len;
     len = this->readFunction(fd, data, sizeOfdata);
     if (len != sizeOfdata) {
         return -1;
     }
+
+    if (sampleCacheEnabled) {
+        storeSample(fd, data, sizeOfdata);
+    }
     return 0;
 }
 
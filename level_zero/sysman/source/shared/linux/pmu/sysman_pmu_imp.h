@@ -9,10 +9,14 @@
 #include "level_zero/sysman/source/shared/linux/pmu/sysman_pmu.h"
 #include "level_zero/sysman/source/shared/linux/zes_os_sysman_imp.h"
 
+#include <chrono>
 #include <linux/perf_event.h>
+#include <mutex>
 #include <string>
 #include <sys/sysinfo.h>
 #include <unistd.h>
+#include <unordered_map>
+#include <vector>
 
 namespace L0 {
 namespace Sysman {
@@ -28,11 +32,22 @@ class PmuInterfaceImp : public PmuInterface, NEO::NonCopyableOrMovableClass {
     int pmuRead(int fd, uint64_t *data, ssize_t sizeOfdata) override;
 
   protected:
+    struct PmuSample {
+        std::chrono::steady_clock::time_point readTime;
+        std::vector<uint64_t> data;
+    };
+
     virtual int getErrorNo();
     virtual int64_t perfEventOpen(perf_event_attr *attr, pid_t pid, int cpu, int groupFd, uint64_t flags);
+    MOCKABLE_VIRTUAL std::chrono::steady_clock::time_point getCurrentTime();
+    bool getCachedSample(int fd, uint64_t *data, ssize_t sizeOfdata, std::chrono::microseconds cacheWindow);
+    void storeSample(int fd, const uint64_t *data, ssize_t sizeOfdata);
+    void invalidateCachedSample(int fd);
     decltype(&read) readFunction = read;
     decltype(&syscall) syscallFunction = syscall;
     SysmanKmdInterface *pSysmanKmdInterface = nullptr;
+    std::unordered_map<int, PmuSample> sampleCache;
+    std::mutex sampleCacheMutex;
 
   private:
     SysmanDeviceImp *pDevice = nullptr;
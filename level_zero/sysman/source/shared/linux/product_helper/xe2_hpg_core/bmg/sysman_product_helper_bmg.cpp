@@ -557,61 +557,72 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getPciProperties(zes_pci_properti
 }
 
 static ze_result_t getPciStatsValues(zes_pci_stats_t *pStats, std::map<std::string, uint64_t> &keyOffsetMap, const std::string &telemNodeDir) {
+    static const std::vector<std::string> pciStatsKeys = {"reg_PCIESS_rx_bytecount_lsb", "reg_PCIESS_rx_bytecount_msb",
+                                                          "reg_PCIESS_tx_bytecount_lsb", "reg_PCIESS_tx_bytecount_msb",
+                                                          "reg_PCIESS_rx_pktcount_lsb", "reg_PCIESS_rx_pktcount_msb",
+                                                          "reg_PCIESS_tx_pktcount_lsb", "reg_PCIESS_tx_pktcount_msb",
+                                                          "GDDR_TELEM_CAPTURE_TIMESTAMP_LOWER", "GDDR_TELEM_CAPTURE_TIMESTAMP_UPPER"};
+
+    PlatformMonitoringTech::TelemSnapshot snapshot;
+    if (!PlatformMonitoringTech::readTelemSnapshot(keyOffsetMap, telemNodeDir, pciStatsKeys, 0, snapshot)) {
+        return ZE_RESULT_ERROR_NOT_AVAILABLE;
+    }
+
     uint32_t rxCounterLsb = 0;
-    if (!PlatformMonitoringTech::readValue(keyOffsetMap, telemNodeDir, "reg_PCIESS_rx_bytecount_lsb", 0, rxCounterLsb)) {
+    if (!PlatformMonitoringTech::readValue(snapshot, keyOffsetMap, "reg_PCIESS_rx_bytecount_lsb", 0, rxCounterLsb)) {
         return ZE_RESULT_ERROR_NOT_AVAILABLE;
     }
 
     uint32_t rxCounterMsb = 0;
-    if (!PlatformMonitoringTech::readValue(keyOffsetMap, telemNodeDir, "reg_PCIESS_rx_bytecount_msb", 0, rxCounterMsb)) {
+    if (!PlatformMonitoringTech::readValue(snapshot, keyOffsetMap, "reg_PCIESS_rx_bytecount_msb", 0, rxCounterMsb)) {
         return ZE_RESULT_ERROR_NOT_AVAILABLE;
     }
 
     uint64_t rxCounter = packInto64Bit(rxCounterMsb, rxCounterLsb);
 
     uint32_t txCounterLsb = 0;
-    if (!PlatformMonitoringTech::readValue(keyOffsetMap, telemNodeDir, "reg_PCIESS_tx_bytecount_lsb", 0, txCounterLsb)) {
+    if (!PlatformMonitoringTech::readValue(snapshot, keyOffsetMap, "reg_PCIESS_tx_bytecount_lsb", 0, txCounterLsb)) {
         return ZE_RESULT_ERROR_NOT_AVAILABLE;
     }
 
     uint32_t txCounterMsb = 0;
-    if (!PlatformMonitoringTech::readValue(keyOffsetMap, telemNodeDir, "reg_PCIESS_tx_bytecount_msb", 0, txCounterMsb)) {
+    if (!PlatformMonitoringTech::readValue(snapshot, keyOffsetMap, "reg_PCIESS_tx_bytecount_msb", 0, txCounterMsb)) {
         return ZE_RESULT_ERROR_NOT_AVAILABLE;
     }
 
     uint64_t txCounter = packInto64Bit(txCounterMsb, txCounterLsb);
 
     uint32_t rxPacketCounterLsb = 0;
-    if (!PlatformMonitoringTech::readValue(keyOffsetMap, telemNodeDir, "reg_PCIESS_rx_pktcount_lsb", 0, rxPacketCounterLsb)) {
+    if (!PlatformMonitoringTech::readValue(snapshot, keyOffsetMap, "reg_PCIESS_rx_pktcount_lsb", 0, rxPacketCounterLsb)) {
         return ZE_RESULT_ERROR_NOT_AVAILABLE;
     }
 
     uint32_t rxPacketCounterMsb = 0;
-    if (!PlatformMonitoringTech::readValue(keyOffsetMap, telemNodeDir, "reg_PCIESS_rx_pktcount_msb", 0, rxPacketCounterMsb)) {
+    if (!PlatformMonitoringTech::readValue(snapshot, keyOffsetMap, "reg_PCIESS_rx_pktcount_msb", 0, rxPacketCounterMsb)) {
         return ZE_RESULT_ERROR_NOT_AVAILABLE;
     }
 
     uint64_t rxPacketCounter = packInto64Bit(rxPacketCounterMsb, rxPacketCounterLsb);
 
     uint32_t txPacketCounterLsb = 0;
-    if (!PlatformMonitoringTech::readValue(keyOffsetMap, telemNodeDir, "reg_PCIESS_tx_pktcount_lsb", 0, txPacketCounterLsb)) {
+    if (!PlatformMonitoringTech::readValue(snapshot, keyOffsetMap, "reg_PCIESS_tx_pktcount_lsb", 0, txPacketCounterLsb)) {
         return ZE_RESULT_ERROR_NOT_AVAILABLE;
     }
 
     uint32_t txPacketCounterMsb = 0;
-    if (!PlatformMonitoringTech::readValue(keyOffsetMap, telemNodeDir, "reg_PCIESS_tx_pktcount_msb", 0, txPacketCounterMsb)) {
+    if (!PlatformMonitoringTech::readValue(snapshot, keyOffsetMap, "reg_PCIESS_tx_pktcount_msb", 0, txPacketCounterMsb)) {
         return ZE_RESULT_ERROR_NOT_AVAILABLE;
     }
 
     uint64_t txPacketCounter = packInto64Bit(txPacketCounterMsb, txPacketCounterLsb);
 
     uint32_t timeStampLsb = 0;
-    if (!PlatformMonitoringTech::readValue(keyOffsetMap, telemNodeDir, "GDDR_TELEM_CAPTURE_TIMESTAMP_LOWER", 0, timeStampLsb)) {
+    if (!PlatformMonitoringTech::readValue(snapshot, keyOffsetMap, "GDDR_TELEM_CAPTURE_TIMESTAMP_LOWER", 0, timeStampLsb)) {
         return ZE_RESULT_ERROR_NOT_AVAILABLE;
     }
 
     uint32_t timeStampMsb = 0;
-    if (!PlatformMonitoringTech::readValue(keyOffsetMap, telemNodeDir, "GDDR_TELEM_CAPTURE_TIMESTAMP_UPPER", 0, timeStampMsb)) {
+    if (!PlatformMonitoringTech::readValue(snapshot, keyOffsetMap, "GDDR_TELEM_CAPTURE_TIMESTAMP_UPPER", 0, timeStampMsb)) {
         return ZE_RESULT_ERROR_NOT_AVAILABLE;
     }
 
@@ -34,22 +34,22 @@ void FdCacheInterface::eraseLeastUsedEntryFromCache() {
     fdMap.erase(leastUsedIterator);
 }
 
-int FdCacheInterface::getFd(std::string file) {
-    int fd = -1;
-    if (fdMap.find(file) == fdMap.end()) {
-        fd = NEO::SysCalls::open(file.c_str(), O_RDONLY);
-        if (fd < 0) {
-            return -1;
-        }
-        if (fdMap.size() == maxSize) {
-            eraseLeastUsedEntryFromCache();
-        }
-        fdMap[file] = std::make_pair(fd, 1);
-    } else {
-        auto &fdPair = fdMap[file];
-        fdPair.second++;
+int FdCacheInterface::getFd(const std::string &file) {
+    auto it = fdMap.find(file);
+    if (it != fdMap.end()) {
+        it->second.second++;
+        return it->second.first;
+    }
+
+    int fd = NEO::SysCalls::open(file.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return -1;
     }
-    return fdMap[file].first;
+    if (fdMap.size() == maxSize) {
+        eraseLeastUsedEntryFromCache();
+    }
+    fdMap.emplace(file, std::make_pair(fd, 1u));
+    return fd;
 }
 
 FdCacheInterface::~FdCacheInterface() {
@@ -60,9 +60,7 @@ FdCacheInterface::~FdCacheInterface() {
 }
 
 template <typename T>
-ze_result_t FsAccessInterface::readValue(const std::string file, T &val) {
-    auto lock = this->obtainMutex();
-
+ze_result_t FsAccessInterface::readValueLocked(const std::string &file, T &val) {
     std::string readVal(64, '\0');
     int fd = pFdCacheInterface->getFd(file);
     if (fd < 0) {
@@ -83,6 +81,27 @@ ze_result_t FsAccessInterface::readValue(const std::string file, T &val) {
     return ZE_RESULT_SUCCESS;
 }
 
+template <typename T>
+ze_result_t FsAccessInterface::readValue(const std::string file, T &val) {
+    auto lock = this->obtainMutex();
+    return readValueLocked(file, val);
+}
+
+// Reads a set of attributes under a single lock, stops at the first failure
+template <typename T>
+ze_result_t FsAccessInterface::readValues(const std::vector<std::string> &files, std::vector<T> &vals) {
+    auto lock = this->obtainMutex();
+
+    vals.resize(files.size());
+    for (size_t i = 0; i < files.size(); i++) {
+        auto result = readValueLocked(files[i], vals[i]);
+        if (result != ZE_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
 // Generic Filesystem Access
 FsAccessInterface::FsAccessInterface() {
     pFdCacheInterface = std::make_unique<FdCacheInterface>();
@@ -108,6 +127,14 @@ ze_result_t FsAccessInterface::read(const std::string file, uint32_t &val) {
     return readValue<uint32_t>(file, val);
 }
 
+ze_result_t FsAccessInterface::read(const std::vector<std::string> &files, std::vector<uint64_t> &vals) {
+    return readValues<uint64_t>(files, vals);
+}
+
+ze_result_t FsAccessInterface::read(const std::vector<std::string> &files, std::vector<double> &vals) {
+    return readValues<double>(files, vals);
+}
+
 ze_result_t FsAccessInterface::read(const std::string file, std::string &val) {
     // Read a single line from text file without trailing newline
     std::ifstream fs;
@@ -400,6 +427,15 @@ std::string SysFsAccessInterface::fullPath(const std::string file) {
     return std::string(dirname + file);
 }
 
+std::vector<std::string> SysFsAccessInterface::fullPaths(const std::vector<std::string> &files) {
+    std::vector<std::string> paths;
+    paths.reserve(files.size());
+    for (const auto &file : files) {
+        paths.push_back(fullPath(file));
+    }
+    return paths;
+}
+
 SysFsAccessInterface::SysFsAccessInterface(const std::string dev) {
     // dev could be either /dev/dri/cardX or /dev/dri/renderDX
     std::string fileName = FsAccessInterface::getBaseName(dev);
@@ -459,6 +495,14 @@ ze_result_t SysFsAccessInterface::read(const std::string file, std::vector<std::
     return FsAccessInterface::read(fullPath(file), val);
 }
 
+ze_result_t SysFsAccessInterface::read(const std::vector<std::string> &files, std::vector<uint64_t> &vals) {
+    return FsAccessInterface::read(fullPaths(files), vals);
+}
+
+ze_result_t SysFsAccessInterface::read(const std::vector<std::string> &files, std::vector<double> &vals) {
+    return FsAccessInterface::read(fullPaths(files), vals);
+}
+
 ze_result_t SysFsAccessInterface::write(const std::string file, const std::string val) {
     // Prepend sysfs directory path and call the base write
     return FsAccessInterface::write(fullPath(file).c_str(), val);
@@ -25,7 +25,7 @@ class FdCacheInterface {
     ~FdCacheInterface();
 
     static const int maxSize = 10;
-    int getFd(std::string file);
+    int getFd(const std::string &file);
 
   protected:
     // Map of File name to pair of file descriptor and reference count to file.
@@ -50,6 +50,8 @@ class FsAccessInterface {
     virtual ze_result_t read(const std::string file, double &val);
     virtual ze_result_t read(const std::string file, uint32_t &val);
     virtual ze_result_t read(const std::string file, int32_t &val);
+    virtual ze_result_t read(const std::vector<std::string> &files, std::vector<uint64_t> &vals);
+    virtual ze_result_t read(const std::vector<std::string> &files, std::vector<double> &vals);
 
     virtual ze_result_t write(const std::string file, const std::string val);
 
@@ -69,6 +71,10 @@ class FsAccessInterface {
   private:
     template <typename T>
     ze_result_t readValue(const std::string file, T &val);
+    template <typename T>
+    ze_result_t readValueLocked(const std::string &file, T &val);
+    template <typename T>
+    ze_result_t readValues(const std::vector<std::string> &files, std::vector<T> &vals);
     std::unique_ptr<FdCacheInterface> pFdCacheInterface = nullptr;
     std::mutex fsMutex{};
 };
@@ -111,6 +117,8 @@ class SysFsAccessInterface : protected FsAccessInterface {
     ze_result_t read(const std::string file, uint64_t &val) override;
     ze_result_t read(const std::string file, double &val) override;
     ze_result_t read(const std::string file, std::vector<std::string> &val) override;
+    ze_result_t read(const std::vector<std::string> &files, std::vector<uint64_t> &vals) override;
+    ze_result_t read(const std::vector<std::string> &files, std::vector<double> &vals) override;
 
     ze_result_t write(const std::string file, const std::string val) override;
     MOCKABLE_VIRTUAL ze_result_t write(const std::string file, const int val);
@@ -135,6 +143,7 @@ class SysFsAccessInterface : protected FsAccessInterface {
 
   private:
     std::string fullPath(const std::string file);
+    std::vector<std::string> fullPaths(const std::vector<std::string> &files);
     std::string dirname;
     static const std::string drmPath;
     static const std::string devicesPath;
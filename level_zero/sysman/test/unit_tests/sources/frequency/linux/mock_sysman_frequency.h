@@ -85,6 +85,8 @@ struct MockFrequencySysfsAccess : public L0::Sysman::SysFsAccessInterface {
     ze_result_t mockReadThermalResult = ZE_RESULT_SUCCESS;
     ze_result_t mockWriteMaxResult = ZE_RESULT_SUCCESS;
     ze_result_t mockWriteMinResult = ZE_RESULT_SUCCESS;
+    ze_result_t mockReadMinDefaultResult = ZE_RESULT_SUCCESS;
+    uint32_t readBatchCallCount = 0;
     ze_bool_t isLegacy = false;
 
     ADDMETHOD_NOBASE(directoryExists, bool, true, (const std::string path));
@@ -136,6 +138,9 @@ struct MockFrequencySysfsAccess : public L0::Sysman::SysFsAccessInterface {
             }
             val = mockMinVal;
         } else if (file.compare(minDefaultFreqFile) == 0) {
+            if (mockReadMinDefaultResult != ZE_RESULT_SUCCESS) {
+                return mockReadMinDefaultResult;
+            }
             val = mockDefaultMin;
         } else if (file.compare(maxDefaultFreqFile) == 0) {
             val = mockDefaultMax;
@@ -146,6 +151,18 @@ struct MockFrequencySysfsAccess : public L0::Sysman::SysFsAccessInterface {
         return ZE_RESULT_SUCCESS;
     }
 
+    ze_result_t read(const std::vector<std::string> &files, std::vector<double> &vals) override {
+        readBatchCallCount++;
+        vals.resize(files.size());
+        for (size_t i = 0; i < files.size(); i++) {
+            ze_result_t result = read(files[i], vals[i]);
+            if (result != ZE_RESULT_SUCCESS) {
+                return result;
+            }
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
     ze_result_t read(const std::string file, uint32_t &val) override {
         if (mockReadUnsignedIntResult != ZE_RESULT_SUCCESS) {
             return mockReadUnsignedIntResult;
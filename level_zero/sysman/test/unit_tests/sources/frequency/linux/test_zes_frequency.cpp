@@ -335,6 +335,36 @@ HWTEST2_F(SysmanDeviceFrequencyFixture, GivenNegativeUnityRangeSetWhenGetRangeIs
     }
 }
 
+HWTEST2_F(SysmanDeviceFrequencyFixture, GivenNegativeUnityRangeSetWhenSetRangeIsCalledThenDefaultFrequenciesAreReadInSingleBatch, IsXeHpOrXeHpcOrXeHpgCore) {
+    auto handles = getFreqHandles(handleComponentCount);
+    for (auto handle : handles) {
+        zes_freq_range_t limits;
+        limits.min = -1;
+        limits.max = -1;
+        pSysfsAccess->readBatchCallCount = 0;
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zesFrequencySetRange(handle, &limits));
+        EXPECT_EQ(1u, pSysfsAccess->readBatchCallCount);
+        EXPECT_DOUBLE_EQ(pSysfsAccess->mockDefaultMin, pSysfsAccess->mockMin);
+        EXPECT_DOUBLE_EQ(pSysfsAccess->mockDefaultMax, pSysfsAccess->mockMax);
+    }
+}
+
+HWTEST2_F(SysmanDeviceFrequencyFixture, GivenNegativeUnityRangeSetAndReadingDefaultFrequencyFailsWhenSetRangeIsCalledThenRequestedRangeIsSet, IsXeHpOrXeHpcOrXeHpgCore) {
+    auto handles = getFreqHandles(handleComponentCount);
+    pSysfsAccess->mockReadMinDefaultResult = ZE_RESULT_ERROR_NOT_AVAILABLE;
+    for (auto handle : handles) {
+        const double negativeMin = -1;
+        const double negativeMax = -1;
+        zes_freq_range_t limits;
+
+        limits.min = negativeMin;
+        limits.max = negativeMax;
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zesFrequencySetRange(handle, &limits));
+        EXPECT_DOUBLE_EQ(negativeMin, pSysfsAccess->mockMin);
+        EXPECT_DOUBLE_EQ(negativeMax, pSysfsAccess->mockMax);
+    }
+}
+
 HWTEST2_F(SysmanDeviceFrequencyFixture, GivenValidFrequencyHandleWhenCallingzesFrequencySetRangeThenVerifyzesFrequencySetRangeTest2CallSucceeds, IsXeHpOrXeHpcOrXeHpgCore) {
     auto handles = getFreqHandles(handleComponentCount);
     for (auto handle : handles) {
@@ -201,6 +201,71 @@ TEST_F(ZesPmtFixture, GivenKeyDoesNotExistinKeyOffsetMapWhenCallingReadValueForU
     EXPECT_FALSE(PlatformMonitoringTech::readValue(keyOffsetMap, mockTelemDir, mockKey, mockOffset, value));
 }
 
+TEST_F(ZesPmtFixture, GivenMultipleKeysWhenReadingTelemSnapshotThenAllValuesAreExtractedFromSingleRead) {
+    static uint32_t telemReadCount = 0;
+    telemReadCount = 0;
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> mockOpen(&NEO::SysCalls::sysCallsOpen, &mockOpenSuccess);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPread)> mockPread(&NEO::SysCalls::sysCallsPread, [](int fd, void *buf, size_t count, off_t offset) -> ssize_t {
+        telemReadCount++;
+        EXPECT_EQ(6, fd);
+        EXPECT_EQ(static_cast<off_t>(100 + 56), offset);
+        EXPECT_EQ(1032u - 56u + sizeof(uint64_t), count);
+        auto data = static_cast<uint8_t *>(buf);
+        uint32_t temperature = 0x2a;
+        uint64_t energy = 0x1234567890ull;
+        memcpy(data, &temperature, sizeof(temperature));
+        memcpy(data + (1032 - 56), &energy, sizeof(energy));
+        return count;
+    });
+
+    std::map<std::string, uint64_t> keyOffsetMap = {{"PACKAGE_ENERGY", 1032}, {"SOC_TEMPERATURES", 56}};
+    PlatformMonitoringTech::TelemSnapshot snapshot;
+    EXPECT_TRUE(PlatformMonitoringTech::readTelemSnapshot(keyOffsetMap, sysfsPathTelem1, {"PACKAGE_ENERGY", "SOC_TEMPERATURES"}, 100, snapshot));
+    EXPECT_EQ(1u, telemReadCount);
+
+    uint32_t temperature = 0;
+    uint64_t energy = 0;
+    EXPECT_TRUE(PlatformMonitoringTech::readValue(snapshot, keyOffsetMap, "SOC_TEMPERATURES", 100, temperature));
+    EXPECT_TRUE(PlatformMonitoringTech::readValue(snapshot, keyOffsetMap, "PACKAGE_ENERGY", 100, energy));
+    EXPECT_EQ(0x2au, temperature);
+    EXPECT_EQ(0x1234567890ull, energy);
+    EXPECT_EQ(1u, telemReadCount);
+}
+
+TEST_F(ZesPmtFixture, GivenKeyDoesNotExistInKeyOffsetMapWhenReadingTelemSnapshotThenFalseIsReturned) {
+    std::map<std::string, uint64_t> keyOffsetMap = {{"PACKAGE_ENERGY", 1032}, {"SOC_TEMPERATURES", 56}};
+    PlatformMonitoringTech::TelemSnapshot snapshot;
+    EXPECT_FALSE(PlatformMonitoringTech::readTelemSnapshot(keyOffsetMap, sysfsPathTelem1, {"PACKAGE_ENERGY", "ABCDE"}, 0, snapshot));
+    EXPECT_FALSE(PlatformMonitoringTech::readTelemSnapshot(keyOffsetMap, sysfsPathTelem1, {}, 0, snapshot));
+}
+
+TEST_F(ZesPmtFixture, GivenTelemReadFailsWhenReadingTelemSnapshotThenFalseIsReturned) {
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> mockOpen(&NEO::SysCalls::sysCallsOpen, &mockOpenSuccess);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPread)> mockPread(&NEO::SysCalls::sysCallsPread, [](int fd, void *buf, size_t count, off_t offset) -> ssize_t {
+        return -1;
+    });
+
+    std::map<std::string, uint64_t> keyOffsetMap = {{"PACKAGE_ENERGY", 1032}, {"SOC_TEMPERATURES", 56}};
+    PlatformMonitoringTech::TelemSnapshot snapshot;
+    EXPECT_FALSE(PlatformMonitoringTech::readTelemSnapshot(keyOffsetMap, sysfsPathTelem1, {"PACKAGE_ENERGY", "SOC_TEMPERATURES"}, 0, snapshot));
+    EXPECT_TRUE(snapshot.data.empty());
+}
+
+TEST_F(ZesPmtFixture, GivenValueOutsideOfSnapshotWhenReadingValueFromSnapshotThenFalseIsReturned) {
+    std::map<std::string, uint64_t> keyOffsetMap = {{"PACKAGE_ENERGY", 1032}, {"SOC_TEMPERATURES", 56}};
+    PlatformMonitoringTech::TelemSnapshot snapshot;
+    snapshot.offset = 56;
+    snapshot.data.resize(sizeof(uint32_t));
+
+    uint32_t value32 = 0;
+    uint64_t value64 = 0;
+    EXPECT_TRUE(PlatformMonitoringTech::readValue(snapshot, keyOffsetMap, "SOC_TEMPERATURES", 0, value32));
+    EXPECT_FALSE(PlatformMonitoringTech::readValue(snapshot, keyOffsetMap, "SOC_TEMPERATURES", 0, value64));
+    EXPECT_FALSE(PlatformMonitoringTech::readValue(snapshot, keyOffsetMap, "PACKAGE_ENERGY", 0, value64));
+    EXPECT_FALSE(PlatformMonitoringTech::readValue(snapshot, keyOffsetMap, "SOC_TEMPERATURES", 8, value32));
+    EXPECT_FALSE(PlatformMonitoringTech::readValue(snapshot, keyOffsetMap, "ABCDE", 0, value32));
+}
+
 } // namespace ult
 } // namespace Sysman
 } // namespace L0
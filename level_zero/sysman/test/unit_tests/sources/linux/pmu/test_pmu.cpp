@@ -155,6 +155,109 @@ TEST_F(SysmanPmuFixture, GivenValidPmuHandleWhenAndDomainErrorOccursThenDomainEr
     EXPECT_EQ(EDOM, pmuInterface->getErrorNo());
 }
 
+struct MockPmuInterfaceImpWithSampleCache : public MockPmuInterfaceImpForSysman {
+    using MockPmuInterfaceImpForSysman::MockPmuInterfaceImpForSysman;
+    using L0::Sysman::PmuInterfaceImp::sampleCache;
+
+    std::chrono::steady_clock::time_point getCurrentTime() override {
+        return currentTime;
+    }
+
+    std::chrono::steady_clock::time_point currentTime{};
+};
+
+static uint32_t pmuReadCallCount = 0;
+inline static ssize_t openReadCountingCalls(int fd, void *data, size_t sizeOfdata) {
+    pmuReadCallCount++;
+    uint64_t dataVal[2] = {mockEventVal * pmuReadCallCount, mockTimeStamp * pmuReadCallCount};
+    memcpy_s(data, sizeOfdata, dataVal, sizeOfdata);
+    return sizeOfdata;
+}
+
+TEST_F(SysmanPmuFixture, GivenSampleCacheWindowIsNotSetWhenCallingPmuReadMultipleTimesThenCounterIsReadEachTime) {
+    pmuReadCallCount = 0;
+    auto pmuInterface = std::make_unique<MockPmuInterfaceImpWithSampleCache>(pLinuxSysmanImp);
+    pmuInterface->readFunction = openReadCountingCalls;
+    uint64_t data[2];
+    int validFd = 10;
+    EXPECT_EQ(0, pmuInterface->pmuRead(validFd, data, sizeof(data)));
+    EXPECT_EQ(0, pmuInterface->pmuRead(validFd, data, sizeof(data)));
+    EXPECT_EQ(2u, pmuReadCallCount);
+    EXPECT_EQ(mockTimeStamp * 2, data[1]);
+    EXPECT_TRUE(pmuInterface->sampleCache.empty());
+}
+
+TEST_F(SysmanPmuFixture, GivenSampleCacheWindowIsSetWhenCallingPmuReadWithinWindowThenCachedSampleIsReturned) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.SysmanPmuSampleCacheWindowUs.set(1000);
+    pmuReadCallCount = 0;
+    auto pmuInterface = std::make_unique<MockPmuInterfaceImpWithSampleCache>(pLinuxSysmanImp);
+    pmuInterface->readFunction = openReadCountingCalls;
+    uint64_t data[2] = {};
+    int validFd = 10;
+
+    EXPECT_EQ(0, pmuInterface->pmuRead(validFd, data, sizeof(data)));
+    pmuInterface->currentTime += std::chrono::microseconds(500);
+    uint64_t cachedData[2] = {};
+    EXPECT_EQ(0, pmuInterface->pmuRead(validFd, cachedData, sizeof(cachedData)));
+    EXPECT_EQ(1u, pmuReadCallCount);
+    EXPECT_EQ(data[0], cachedData[0]);
+    EXPECT_EQ(data[1], cachedData[1]);
+
+    int otherFd = 11;
+    EXPECT_EQ(0, pmuInterface->pmuRead(otherFd, cachedData, sizeof(cachedData)));
+    EXPECT_EQ(2u, pmuReadCallCount);
+
+    pmuInterface->currentTime += std::chrono::microseconds(1001);
+    EXPECT_EQ(0, pmuInterface->pmuRead(validFd, data, sizeof(data)));
+    EXPECT_EQ(3u, pmuReadCallCount);
+    EXPECT_EQ(mockTimeStamp * 3, data[1]);
+}
+
+TEST_F(SysmanPmuFixture, GivenSampleCacheWindowIsSetWhenCounterIsClosedAndReopenedWithSameFdWithinWindowThenCounterIsReadAgain) {
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPread)> mockPread(&NEO::SysCalls::sysCallsPread, [](int fd, void *buf, size_t count, off_t offset) -> ssize_t {
+        std::ostringstream oStream;
+        oStream << 18;
+        std::string value = oStream.str();
+        memcpy(buf, value.data(), count);
+        return count;
+    });
+
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.SysmanPmuSampleCacheWindowUs.set(1000);
+    pmuReadCallCount = 0;
+    auto pmuInterface = std::make_unique<MockPmuInterfaceImpWithSampleCache>(pLinuxSysmanImp);
+    pmuInterface->readFunction = openReadCountingCalls;
+    pmuInterface->syscallFunction = syscallReturnSuccess;
+    uint64_t data[2] = {};
+
+    auto fd = pmuInterface->pmuInterfaceOpen(10, -1, PERF_FORMAT_TOTAL_TIME_ENABLED);
+    EXPECT_EQ(mockPmuFd, fd);
+    EXPECT_EQ(0, pmuInterface->pmuRead(static_cast<int>(fd), data, sizeof(data)));
+    EXPECT_EQ(1u, pmuReadCallCount);
+
+    // counter closed and reopened, kernel hands back the same fd
+    fd = pmuInterface->pmuInterfaceOpen(10, -1, PERF_FORMAT_TOTAL_TIME_ENABLED);
+    EXPECT_EQ(mockPmuFd, fd);
+    EXPECT_TRUE(pmuInterface->sampleCache.empty());
+
+    pmuInterface->currentTime += std::chrono::microseconds(500);
+    EXPECT_EQ(0, pmuInterface->pmuRead(static_cast<int>(fd), data, sizeof(data)));
+    EXPECT_EQ(2u, pmuReadCallCount);
+    EXPECT_EQ(mockTimeStamp * 2, data[1]);
+}
+
+TEST_F(SysmanPmuFixture, GivenSampleCacheWindowIsSetAndReadFailsWhenCallingPmuReadThenFailureIsReturnedAndSampleIsNotCached) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.SysmanPmuSampleCacheWindowUs.set(1000);
+    auto pmuInterface = std::make_unique<MockPmuInterfaceImpWithSampleCache>(pLinuxSysmanImp);
+    pmuInterface->readFunction = openReadReturnFailure;
+    uint64_t data[2];
+    int validFd = 10;
+    EXPECT_EQ(-1, pmuInterface->pmuRead(validFd, data, sizeof(data)));
+    EXPECT_TRUE(pmuInterface->sampleCache.empty());
+}
+
 } // namespace ult
 } // namespace Sysman
 } // namespace L0
@@ -304,6 +304,67 @@ TEST_F(SysmanDeviceFixture, GivenValidMockMutexFsAccessWhenCallingReadThenMutexL
     delete tempFsAccess;
 }
 
+TEST_F(SysmanDeviceFixture, GivenSysfsAccessClassWhenReadingMultipleFilesInBatchThenAllValuesAreReturnedUnderSingleLockAndFilesAreOpenedOnce) {
+    static uint32_t openCount = 0;
+    openCount = 0;
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> mockOpen(&NEO::SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int {
+        openCount++;
+        return static_cast<int>(openCount);
+    });
+
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPread)> mockPread(&NEO::SysCalls::sysCallsPread, [](int fd, void *buf, size_t count, off_t offset) -> ssize_t {
+        std::string value = std::to_string(fd * 100);
+        memcpy(buf, value.data(), value.size());
+        return value.size();
+    });
+
+    class MockMutexSysfsAccess : public L0::Sysman::SysFsAccessInterface {
+      public:
+        uint32_t mutexLockCounter = 0;
+        std::unique_lock<std::mutex> obtainMutex() override {
+            mutexLockCounter++;
+            return L0::Sysman::SysFsAccessInterface::obtainMutex();
+        }
+    };
+
+    auto tempSysfsAccess = std::make_unique<MockMutexSysfsAccess>();
+    const std::vector<std::string> files = {"mockfile0.txt", "mockfile1.txt", "mockfile2.txt"};
+    std::vector<uint64_t> values;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, tempSysfsAccess->read(files, values));
+    ASSERT_EQ(files.size(), values.size());
+    EXPECT_EQ(100u, values[0]);
+    EXPECT_EQ(200u, values[1]);
+    EXPECT_EQ(300u, values[2]);
+    EXPECT_EQ(1u, tempSysfsAccess->mutexLockCounter);
+
+    std::vector<double> doubleValues;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, tempSysfsAccess->read(files, doubleValues));
+    ASSERT_EQ(files.size(), doubleValues.size());
+    EXPECT_DOUBLE_EQ(300.0, doubleValues[2]);
+    EXPECT_EQ(2u, tempSysfsAccess->mutexLockCounter);
+    EXPECT_EQ(3u, openCount);
+}
+
+TEST_F(SysmanDeviceFixture, GivenSysfsAccessClassAndOneFileCannotBeOpenedWhenReadingMultipleFilesInBatchThenErrorIsReturned) {
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> mockOpen(&NEO::SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int {
+        if (std::string(pathname).find("missing") != std::string::npos) {
+            errno = ENOENT;
+            return -1;
+        }
+        return 1;
+    });
+
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPread)> mockPread(&NEO::SysCalls::sysCallsPread, [](int fd, void *buf, size_t count, off_t offset) -> ssize_t {
+        std::string value = "123";
+        memcpy(buf, value.data(), value.size());
+        return value.size();
+    });
+
+    auto tempSysfsAccess = std::make_unique<PublicSysfsAccess>();
+    std::vector<uint64_t> values;
+    EXPECT_EQ(ZE_RESULT_ERROR_NOT_AVAILABLE, tempSysfsAccess->read(std::vector<std::string>{"mockfile0.txt", "missing.txt"}, values));
+}
+
 TEST(FdCacheTest, GivenValidFdCacheWhenCallingGetFdOnSameFileThenVerifyCacheIsUpdatedProperly) {
 
     class MockFdCache : public FdCacheInterface {
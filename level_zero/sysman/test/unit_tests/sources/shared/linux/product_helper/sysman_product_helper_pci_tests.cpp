@@ -75,44 +75,31 @@ static int mockOpenSuccess(const char *pathname, int flags) {
     return -1;
 }
 
+static void copyMockTelemValues(void *buf, size_t count, off_t offset) {
+    const std::vector<std::pair<uint64_t, uint32_t>> mockTelemValues = {{mockRxCounterLsbOffset, mockRxCounterLsb},
+                                                                        {mockRxCounterMsbOffset, mockRxCounterMsb},
+                                                                        {mockTxCounterLsbOffset, mockTxCounterLsb},
+                                                                        {mockTxCounterMsbOffset, mockTxCounterMsb},
+                                                                        {mockRxPacketCounterLsbOffset, mockRxPacketCounterLsb},
+                                                                        {mockRxPacketCounterMsbOffset, mockRxPacketCounterMsb},
+                                                                        {mockTxPacketCounterLsbOffset, mockTxPacketCounterLsb},
+                                                                        {mockTxPacketCounterMsbOffset, mockTxPacketCounterMsb},
+                                                                        {mockTimestampLsbOffset, mockTimestampLsb},
+                                                                        {mockTimestampMsbOffset, mockTimestampMsb}};
+    for (const auto &telemValue : mockTelemValues) {
+        if (telemValue.first >= static_cast<uint64_t>(offset) && telemValue.first + sizeof(uint32_t) <= static_cast<uint64_t>(offset) + count) {
+            memcpy(static_cast<uint8_t *>(buf) + (telemValue.first - offset), &telemValue.second, sizeof(uint32_t));
+        }
+    }
+}
+
 static ssize_t mockPreadSuccess(int fd, void *buf, size_t count, off_t offset) {
     if (fd == telem3FileAndFdMap.at(telem3GuidFile)) {
         memcpy(buf, mockValidGuid.data(), count);
     } else if (fd == telem3FileAndFdMap.at(telem3OffsetFile)) {
         memcpy(buf, telem3OffsetString.data(), count);
     } else if (fd == telem3FileAndFdMap.at(telem3TelemFile)) {
-        switch (offset) {
-        case mockRxCounterLsbOffset:
-            memcpy(buf, &mockRxCounterLsb, count);
-            break;
-        case mockRxCounterMsbOffset:
-            memcpy(buf, &mockRxCounterMsb, count);
-            break;
-        case mockTxCounterLsbOffset:
-            memcpy(buf, &mockTxCounterLsb, count);
-            break;
-        case mockTxCounterMsbOffset:
-            memcpy(buf, &mockTxCounterMsb, count);
-            break;
-        case mockRxPacketCounterLsbOffset:
-            memcpy(buf, &mockRxPacketCounterLsb, count);
-            break;
-        case mockRxPacketCounterMsbOffset:
-            memcpy(buf, &mockRxPacketCounterMsb, count);
-            break;
-        case mockTxPacketCounterLsbOffset:
-            memcpy(buf, &mockTxPacketCounterLsb, count);
-            break;
-        case mockTxPacketCounterMsbOffset:
-            memcpy(buf, &mockTxPacketCounterMsb, count);
-            break;
-        case mockTimestampLsbOffset:
-            memcpy(buf, &mockTimestampLsb, count);
-            break;
-        case mockTimestampMsbOffset:
-            memcpy(buf, &mockTimestampMsb, count);
-            break;
-        }
+        copyMockTelemValues(buf, count, offset);
     }
     return count;
 }
@@ -163,57 +150,51 @@ HWTEST2_F(SysmanProductHelperPciTest, GivenSysmanProductHelperInstanceWhenGetPci
 }
 
 HWTEST2_F(SysmanProductHelperPciTest, GivenSysmanProductHelperInstanceWhenGetPciStatsIsCalledAndReadValueFromPmtUtilFailsThenCallFails, IsBMG) {
-    static int readFailCount = 1;
     VariableBackup<decltype(NEO::SysCalls::sysCallsReadlink)> mockReadLink(&NEO::SysCalls::sysCallsReadlink, &mockReadLinkSuccess);
     VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> mockOpen(&NEO::SysCalls::sysCallsOpen, &mockOpenSuccess);
     VariableBackup<decltype(NEO::SysCalls::sysCallsPread)> mockPread(&NEO::SysCalls::sysCallsPread, [](int fd, void *buf, size_t count, off_t offset) -> ssize_t {
-        if (fd == telem3FileAndFdMap.at(telem3GuidFile)) {
-            memcpy(buf, mockValidGuid.data(), count);
-        } else if (fd == telem3FileAndFdMap.at(telem3OffsetFile)) {
-            memcpy(buf, telem3OffsetString.data(), count);
-        } else if (fd == telem3FileAndFdMap.at(telem3TelemFile)) {
-            switch (offset) {
-            case mockRxCounterLsbOffset:
-                count = (readFailCount == 1) ? -1 : sizeof(uint32_t);
-                break;
-            case mockRxCounterMsbOffset:
-                count = (readFailCount == 2) ? -1 : sizeof(uint32_t);
-                break;
-            case mockTxCounterLsbOffset:
-                count = (readFailCount == 3) ? -1 : sizeof(uint32_t);
-                break;
-            case mockTxCounterMsbOffset:
-                count = (readFailCount == 4) ? -1 : sizeof(uint32_t);
-                break;
-            case mockRxPacketCounterLsbOffset:
-                count = (readFailCount == 5) ? -1 : sizeof(uint32_t);
-                break;
-            case mockRxPacketCounterMsbOffset:
-                count = (readFailCount == 6) ? -1 : sizeof(uint32_t);
-                break;
-            case mockTxPacketCounterLsbOffset:
-                count = (readFailCount == 7) ? -1 : sizeof(uint32_t);
-                break;
-            case mockTxPacketCounterMsbOffset:
-                count = (readFailCount == 8) ? -1 : sizeof(uint32_t);
-                break;
-            case mockTimestampLsbOffset:
-                count = (readFailCount == 9) ? -1 : sizeof(uint32_t);
-                break;
-            case mockTimestampMsbOffset:
-                count = (readFailCount == 10) ? -1 : sizeof(uint32_t);
-                break;
-            }
+        if (fd == telem3FileAndFdMap.at(telem3TelemFile)) {
+            return -1;
         }
-        return count;
+        return mockPreadSuccess(fd, buf, count, offset);
     });
 
     auto pSysmanProductHelper = L0::Sysman::SysmanProductHelper::create(defaultHwInfo->platform.eProductFamily);
     zes_pci_stats_t stats = {};
-    while (readFailCount <= 10) {
-        EXPECT_EQ(ZE_RESULT_ERROR_NOT_AVAILABLE, pSysmanProductHelper->getPciStats(&stats, pLinuxSysmanImp));
-        readFailCount++;
-    }
+    EXPECT_EQ(ZE_RESULT_ERROR_NOT_AVAILABLE, pSysmanProductHelper->getPciStats(&stats, pLinuxSysmanImp));
+}
+
+HWTEST2_F(SysmanProductHelperPciTest, GivenSysmanProductHelperInstanceWhenGetPciStatsIsCalledAndTelemSnapshotIsTruncatedThenCallFails, IsBMG) {
+    VariableBackup<decltype(NEO::SysCalls::sysCallsReadlink)> mockReadLink(&NEO::SysCalls::sysCallsReadlink, &mockReadLinkSuccess);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> mockOpen(&NEO::SysCalls::sysCallsOpen, &mockOpenSuccess);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPread)> mockPread(&NEO::SysCalls::sysCallsPread, [](int fd, void *buf, size_t count, off_t offset) -> ssize_t {
+        if (fd == telem3FileAndFdMap.at(telem3TelemFile)) {
+            return mockPreadSuccess(fd, buf, sizeof(uint32_t), offset);
+        }
+        return mockPreadSuccess(fd, buf, count, offset);
+    });
+
+    auto pSysmanProductHelper = L0::Sysman::SysmanProductHelper::create(defaultHwInfo->platform.eProductFamily);
+    zes_pci_stats_t stats = {};
+    EXPECT_EQ(ZE_RESULT_ERROR_NOT_AVAILABLE, pSysmanProductHelper->getPciStats(&stats, pLinuxSysmanImp));
+}
+
+HWTEST2_F(SysmanProductHelperPciTest, GivenSysmanProductHelperInstanceWhenGetPciStatsIsCalledThenTelemetryIsReadOnce, IsBMG) {
+    static uint32_t telemReadCount = 0;
+    telemReadCount = 0;
+    VariableBackup<decltype(NEO::SysCalls::sysCallsReadlink)> mockReadLink(&NEO::SysCalls::sysCallsReadlink, &mockReadLinkSuccess);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> mockOpen(&NEO::SysCalls::sysCallsOpen, &mockOpenSuccess);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPread)> mockPread(&NEO::SysCalls::sysCallsPread, [](int fd, void *buf, size_t count, off_t offset) -> ssize_t {
+        if (fd == telem3FileAndFdMap.at(telem3TelemFile)) {
+            telemReadCount++;
+        }
+        return mockPreadSuccess(fd, buf, count, offset);
+    });
+
+    auto pSysmanProductHelper = L0::Sysman::SysmanProductHelper::create(defaultHwInfo->platform.eProductFamily);
+    zes_pci_stats_t stats = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pSysmanProductHelper->getPciStats(&stats, pLinuxSysmanImp));
+    EXPECT_EQ(1u, telemReadCount);
 }
 
 HWTEST2_F(SysmanProductHelperPciTest, GivenSysmanProductHelperInstanceWhenGetPciStatsIsCalledThenCallSucceeds, IsBMG) {
@@ -12,6 +12,7 @@
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/helpers/sleep.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/linux/drm_allocation.h"
@@ -208,14 +209,18 @@ void DebugSessionLinux::closeAsyncThread() {
     asyncThread.close();
 }
 
-bool DebugSessionLinux::checkForceExceptionBit(uint64_t memoryHandle, EuThread::ThreadId threadId, uint32_t *cr0, const SIP::regset_desc *regDesc) {
+bool DebugSessionLinux::checkForceExceptionBit(uint64_t memoryHandle, EuThread::ThreadId threadId, uint32_t *cr0, const SIP::regset_desc *regDesc, const void *stateSaveArea) {
 
-    auto gpuVa = getContextStateSaveAreaGpuVa(memoryHandle);
     auto threadSlotOffset = calculateThreadSlotOffset(threadId);
     auto startRegOffset = threadSlotOffset + calculateRegisterOffsetInThreadSlot(regDesc, 0);
 
-    [[maybe_unused]] int ret = readGpuMemory(memoryHandle, reinterpret_cast<char *>(cr0), 1 * regDesc->bytes, gpuVa + startRegOffset);
-    DEBUG_BREAK_IF(ret != ZE_RESULT_SUCCESS);
+    if (stateSaveArea) {
+        memcpy_s(cr0, 1 * regDesc->bytes, ptrOffset(stateSaveArea, startRegOffset), 1 * regDesc->bytes);
+    } else {
+        auto gpuVa = getContextStateSaveAreaGpuVa(memoryHandle);
+        [[maybe_unused]] int ret = readGpuMemory(memoryHandle, reinterpret_cast<char *>(cr0), 1 * regDesc->bytes, gpuVa + startRegOffset);
+        DEBUG_BREAK_IF(ret != ZE_RESULT_SUCCESS);
+    }
 
     const uint32_t cr0ForcedExcpetionBitmask = 0x04000000;
     if (cr0[1] & cr0ForcedExcpetionBitmask) {
@@ -259,17 +264,35 @@ void DebugSessionLinux::checkStoppedThreadsAndGenerateEvents(const std::vector<E
     auto cr0 = std::make_unique<uint32_t[]>(regSize / sizeof(uint32_t));
     auto regDesc = typeToRegsetDesc(ZET_DEBUG_REGSET_TYPE_CR_INTEL_GPU);
 
+    // For multiple threads to check - read whole state save area
+    // to avoid per-thread calls to KMD
+    const char *stateSaveArea = nullptr;
+    if (threadsToCheck.size() > 1) {
+        auto gpuVa = getContextStateSaveAreaGpuVa(memoryHandle);
+        auto stateSaveAreaSize = getContextStateSaveAreaSize(memoryHandle);
+
+        if (gpuVa != 0 && stateSaveAreaSize != 0) {
+            allocateStateSaveAreaMemory(stateSaveAreaSize);
+            if (readGpuMemory(memoryHandle, stateSaveAreaMemory.data(), stateSaveAreaSize, gpuVa) == ZE_RESULT_SUCCESS) {
+                stateSaveArea = stateSaveAreaMemory.data();
+            }
+        }
+    }
+
     for (auto &threadId : threadsToCheck) {
         SIP::sr_ident srMagic = {{0}};
         srMagic.count = 0;
 
-        if (readSystemRoutineIdent(allThreads[threadId].get(), memoryHandle, srMagic)) {
+        bool srIdentRead = stateSaveArea ? readSystemRoutineIdentFromMemory(allThreads[threadId].get(), stateSaveArea, srMagic)
+                                         : readSystemRoutineIdent(allThreads[threadId].get(), memoryHandle, srMagic);
+
+        if (srIdentRead) {
             bool wasStopped = allThreads[threadId]->isStopped();
             bool checkIfStopped = true;
 
             if (srMagic.count % 2 == 1) {
                 memset(cr0.get(), 0, regSize);
-                checkIfStopped = !checkForceExceptionBit(memoryHandle, threadId, cr0.get(), regDesc);
+                checkIfStopped = !checkForceExceptionBit(memoryHandle, threadId, cr0.get(), regDesc, stateSaveArea);
             }
 
             if (checkIfStopped && allThreads[threadId]->verifyStopped(srMagic.count)) {
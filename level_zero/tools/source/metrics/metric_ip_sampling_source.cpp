@@ -22,6 +22,7 @@
 #include "level_zero/zet_intel_gpu_metric_export.h"
 #include <level_zero/zet_api.h>
 
+#include <algorithm>
 #include <cstring>
 
 namespace L0 {
@@ -455,7 +456,7 @@ ze_result_t IpSamplingMetricGroupImp::getCalculatedMetricValues(const zet_metric
                                                                 uint32_t &metricValueCount,
                                                                 zet_typed_value_t *pCalculatedData) {
     bool dataOverflow = false;
-    std::map<uint64_t, void *> stallReportDataMap;
+    std::unordered_map<uint64_t, void *> stallReportDataMap;
 
     // MAX_METRIC_VALUES is not supported yet.
     if (type != ZET_METRIC_GROUP_CALCULATION_TYPE_METRIC_VALUES) {
@@ -475,18 +476,26 @@ ze_result_t IpSamplingMetricGroupImp::getCalculatedMetricValues(const zet_metric
     DeviceImp *deviceImp = static_cast<DeviceImp *>(&this->getMetricSource().getMetricDeviceContext().getDevice());
     auto &l0GfxCoreHelper = deviceImp->getNEODevice()->getRootDeviceEnvironment().getHelper<L0GfxCoreHelper>();
 
+    stallReportDataMap.reserve(std::min(rawReportCount, IpSamplingMetricGroupBase::stallReportDataMapInitialCapacity));
     for (const uint8_t *pRawIpData = pRawData; pRawIpData < pRawData + (rawReportCount * rawReportSize); pRawIpData += rawReportSize) {
         dataOverflow |= l0GfxCoreHelper.stallIpDataMapUpdate(stallReportDataMap, pRawIpData);
     }
 
     metricValueCount = std::min<uint32_t>(metricValueCount, static_cast<uint32_t>(stallReportDataMap.size()) * properties.metricCount);
+
+    // values are reported in ascending IP order
+    std::vector<std::pair<uint64_t, void *>> sortedStallReportData(stallReportDataMap.begin(), stallReportDataMap.end());
+    std::sort(sortedStallReportData.begin(), sortedStallReportData.end(),
+              [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; });
+
     std::vector<zet_typed_value_t> ipDataValues;
+    ipDataValues.reserve(properties.metricCount);
     uint32_t i = 0;
-    for (auto it = stallReportDataMap.begin(); it != stallReportDataMap.end(); ++it) {
+    for (auto it = sortedStallReportData.begin(); (it != sortedStallReportData.end()) && (i < metricValueCount); ++it) {
         l0GfxCoreHelper.stallSumIpDataToTypedValues(it->first, it->second, ipDataValues);
-        for (auto jt = ipDataValues.begin(); (jt != ipDataValues.end()) && (i < metricValueCount); jt++, i++) {
-            *(pCalculatedData + i) = *jt;
-        }
+        auto valuesToCopy = std::min<uint32_t>(static_cast<uint32_t>(ipDataValues.size()), metricValueCount - i);
+        memcpy_s(pCalculatedData + i, valuesToCopy * sizeof(zet_typed_value_t), ipDataValues.data(), valuesToCopy * sizeof(zet_typed_value_t));
+        i += valuesToCopy;
         ipDataValues.clear();
     }
     l0GfxCoreHelper.stallIpDataMapDelete(stallReportDataMap);
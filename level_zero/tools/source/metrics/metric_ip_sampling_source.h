@@ -73,6 +73,7 @@ class IpSamplingMetricSourceImp : public MetricSource {
 struct IpSamplingMetricGroupBase : public MetricGroupImp {
     IpSamplingMetricGroupBase(MetricSource &metricSource) : MetricGroupImp(metricSource) {}
     static constexpr uint32_t rawReportSize = 64u;
+    static constexpr uint32_t stallReportDataMapInitialCapacity = 4096u;
     bool activate() override { return true; }
     bool deactivate() override { return true; };
     ze_result_t metricQueryPoolCreate(
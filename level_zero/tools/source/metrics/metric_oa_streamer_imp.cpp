@@ -7,7 +7,9 @@
 
 #include "level_zero/tools/source/metrics/metric_oa_streamer_imp.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/string.h"
 
 #include "level_zero/core/source/cmdlist/cmdlist.h"
 #include "level_zero/core/source/device/device_imp.h"
@@ -19,6 +21,71 @@ using namespace MetricsLibraryApi;
 
 namespace L0 {
 
+void OaMetricReportRing::initialize(uint32_t rawReportSize, uint32_t capacityInReports) {
+    this->rawReportSize = rawReportSize;
+    this->capacity = capacityInReports;
+    storage.resize(static_cast<size_t>(rawReportSize) * capacityInReports);
+    head = 0;
+    reportCount = 0;
+    droppedReportCount = 0;
+}
+
+void OaMetricReportRing::push(const uint8_t *reports, uint32_t count) {
+    if (capacity == 0) {
+        droppedReportCount += count;
+        return;
+    }
+
+    // Keep only the newest reports that fit.
+    if (count > capacity) {
+        const uint32_t skipped = count - capacity;
+        reports += static_cast<size_t>(skipped) * rawReportSize;
+        count = capacity;
+        droppedReportCount += skipped;
+    }
+
+    // Make room by dropping the oldest reports.
+    const uint32_t freeCount = capacity - reportCount;
+    if (count > freeCount) {
+        const uint32_t dropped = count - freeCount;
+        head = (head + dropped) % capacity;
+        reportCount -= dropped;
+        droppedReportCount += dropped;
+    }
+
+    uint32_t tail = (head + reportCount) % capacity;
+    const uint32_t firstChunk = std::min(count, capacity - tail);
+    memcpy_s(storage.data() + static_cast<size_t>(tail) * rawReportSize, static_cast<size_t>(capacity - tail) * rawReportSize,
+             reports, static_cast<size_t>(firstChunk) * rawReportSize);
+    if (count > firstChunk) {
+        memcpy_s(storage.data(), storage.size(),
+                 reports + static_cast<size_t>(firstChunk) * rawReportSize, static_cast<size_t>(count - firstChunk) * rawReportSize);
+    }
+    reportCount += count;
+}
+
+uint32_t OaMetricReportRing::pop(uint8_t *output, uint32_t maxCount) {
+    const uint32_t count = std::min(reportCount, maxCount);
+    if (count == 0) {
+        return 0;
+    }
+
+    const uint32_t firstChunk = std::min(count, capacity - head);
+    memcpy_s(output, static_cast<size_t>(count) * rawReportSize,
+             storage.data() + static_cast<size_t>(head) * rawReportSize, static_cast<size_t>(firstChunk) * rawReportSize);
+    if (count > firstChunk) {
+        memcpy_s(output + static_cast<size_t>(firstChunk) * rawReportSize, static_cast<size_t>(count - firstChunk) * rawReportSize,
+                 storage.data(), static_cast<size_t>(count - firstChunk) * rawReportSize);
+    }
+    head = (head + count) % capacity;
+    reportCount -= count;
+    return count;
+}
+
+OaMetricStreamerImp::~OaMetricStreamerImp() {
+    stopBackgroundRead();
+}
+
 ze_result_t OaMetricStreamerImp::readData(uint32_t maxReportCount, size_t *pRawDataSize,
                                           uint8_t *pRawData) {
     ze_result_t result = ZE_RESULT_SUCCESS;
@@ -81,6 +148,10 @@ ze_result_t OaMetricStreamerImp::readData(uint32_t maxReportCount, size_t *pRawD
         // User is expected to allocate space.
         DEBUG_BREAK_IF(pRawData == nullptr);
 
+        if (backgroundReadThread.joinable()) {
+            return readBackgroundData(pRawDataSize, pRawData);
+        }
+
         // Retrieve the number of reports that fit into the buffer.
         uint32_t reportCount = static_cast<uint32_t>(*pRawDataSize / rawReportSize);
 
@@ -169,6 +240,10 @@ ze_result_t OaMetricStreamerImp::startMeasurements(uint32_t &notifyEveryNReports
     if (result == ZE_RESULT_SUCCESS) {
         oaBufferSize = requestedOaBufferSize;
         notifyEveryNReports = getNotifyEveryNReports(requestedOaBufferSize);
+
+        if (NEO::debugManager.flags.MetricStreamerBackgroundReadReportCount.get() > 0) {
+            startBackgroundRead(static_cast<uint32_t>(NEO::debugManager.flags.MetricStreamerBackgroundReadReportCount.get()));
+        }
     }
 
     return result;
@@ -177,6 +252,9 @@ ze_result_t OaMetricStreamerImp::startMeasurements(uint32_t &notifyEveryNReports
 ze_result_t OaMetricStreamerImp::stopMeasurements() {
     auto metricGroup = static_cast<OaMetricGroupImp *>(MetricGroup::fromHandle(hMetricGroup));
 
+    // Background reader uses oa io stream, so it has to finish before the stream is closed.
+    stopBackgroundRead();
+
     const ze_result_t result = metricGroup->closeIoStream();
     if (result == ZE_RESULT_SUCCESS) {
         oaBufferSize = 0;
@@ -204,6 +282,13 @@ Event::State OaMetricStreamerImp::getNotificationState() {
         return Event::State::STATE_INITIAL;
     }
 
+    if (backgroundReadThread.joinable()) {
+        std::lock_guard<std::mutex> lock(reportRingMutex);
+        return reportRing.getReportCount() > 0
+                   ? Event::State::STATE_SIGNALED
+                   : Event::State::STATE_INITIAL;
+    }
+
     auto metricGroup = static_cast<OaMetricGroupImp *>(MetricGroup::fromHandle(hMetricGroup));
     bool reportsReady = metricGroup->waitForReports(0) == ZE_RESULT_SUCCESS;
 
@@ -216,9 +301,84 @@ std::vector<zet_metric_streamer_handle_t> &OaMetricStreamerImp::getMetricStreame
     return metricStreamers;
 }
 
+uint64_t OaMetricStreamerImp::getDroppedReportCount() {
+    uint64_t droppedReportCount = 0;
+    if (metricStreamers.size() > 0) {
+        for (auto metricStreamer : metricStreamers) {
+            droppedReportCount += static_cast<OaMetricStreamerImp *>(MetricStreamer::fromHandle(metricStreamer))->getDroppedReportCount();
+        }
+        return droppedReportCount;
+    }
+
+    std::lock_guard<std::mutex> lock(reportRingMutex);
+    return reportRing.getDroppedReportCount();
+}
+
+void OaMetricStreamerImp::startBackgroundRead(uint32_t capacityInReports) {
+    DEBUG_BREAK_IF(rawReportSize == 0);
+    reportRing.initialize(rawReportSize, capacityInReports);
+    reportedDroppedReportCount = 0;
+    ioStreamDroppedData = false;
+    backgroundReadResult = ZE_RESULT_SUCCESS;
+
+    backgroundReadActive = true;
+    backgroundReadThread = std::thread([this]() { backgroundRead(); });
+}
+
+void OaMetricStreamerImp::stopBackgroundRead() {
+    backgroundReadActive = false;
+    if (backgroundReadThread.joinable()) {
+        backgroundReadThread.join();
+    }
+}
+
+void OaMetricStreamerImp::backgroundRead() {
+    auto metricGroup = static_cast<OaMetricGroupImp *>(MetricGroup::fromHandle(hMetricGroup));
+
+    // Reports are read from oa buffer into staging buffer without holding the lock,
+    // so readers of the ring are not stalled by io stream reads.
+    const uint32_t stagingReportCount = std::max(oaBufferSize / rawReportSize, 1u);
+    std::vector<uint8_t> stagingBuffer(static_cast<size_t>(stagingReportCount) * rawReportSize);
+
+    while (backgroundReadActive) {
+        if (metricGroup->waitForReports(backgroundReadWaitTimeoutMs) != ZE_RESULT_SUCCESS) {
+            continue;
+        }
+
+        uint32_t reportCount = stagingReportCount;
+        const ze_result_t result = metricGroup->readIoStream(reportCount, *stagingBuffer.data());
+
+        std::lock_guard<std::mutex> lock(reportRingMutex);
+        if (result != ZE_RESULT_SUCCESS && result != ZE_RESULT_WARNING_DROPPED_DATA) {
+            backgroundReadResult = result;
+            break;
+        }
+        reportRing.push(stagingBuffer.data(), reportCount);
+        ioStreamDroppedData |= (result == ZE_RESULT_WARNING_DROPPED_DATA);
+    }
+}
+
+ze_result_t OaMetricStreamerImp::readBackgroundData(size_t *pRawDataSize, uint8_t *pRawData) {
+    std::lock_guard<std::mutex> lock(reportRingMutex);
+
+    const uint32_t reportCount = reportRing.pop(pRawData, static_cast<uint32_t>(*pRawDataSize / rawReportSize));
+    *pRawDataSize = static_cast<size_t>(reportCount) * rawReportSize;
+
+    if (reportCount == 0 && backgroundReadResult != ZE_RESULT_SUCCESS) {
+        return backgroundReadResult;
+    }
+
+    // Report dropped data once per overflow.
+    const bool droppedData = ioStreamDroppedData || (reportRing.getDroppedReportCount() != reportedDroppedReportCount);
+    ioStreamDroppedData = false;
+    reportedDroppedReportCount = reportRing.getDroppedReportCount();
+
+    return droppedData ? ZE_RESULT_WARNING_DROPPED_DATA : ZE_RESULT_SUCCESS;
+}
+
 uint32_t OaMetricStreamerImp::getRequiredBufferSize(const uint32_t maxReportCount) const {
     DEBUG_BREAK_IF(rawReportSize == 0);
-    uint32_t maxOaBufferReportCount = oaBufferSize / rawReportSize;
+    uint32_t maxOaBufferReportCount = std::max(oaBufferSize / rawReportSize, reportRing.getCapacity());
 
     // Trim report count if needed.
     const auto reportCount = std::min(maxOaBufferReportCount, maxReportCount);
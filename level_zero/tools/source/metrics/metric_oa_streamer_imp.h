@@ -9,12 +9,36 @@
 
 #include "level_zero/tools/source/metrics/metric.h"
 
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 struct Event;
 
 namespace L0 {
 
+// Fixed capacity ring of raw OA reports. When full, the oldest reports are dropped.
+struct OaMetricReportRing {
+    void initialize(uint32_t rawReportSize, uint32_t capacityInReports);
+    void push(const uint8_t *reports, uint32_t count);
+    uint32_t pop(uint8_t *output, uint32_t maxCount);
+
+    uint32_t getCapacity() const { return capacity; }
+    uint32_t getReportCount() const { return reportCount; }
+    uint64_t getDroppedReportCount() const { return droppedReportCount; }
+
+  protected:
+    std::vector<uint8_t> storage;
+    uint32_t rawReportSize = 0;
+    uint32_t capacity = 0;
+    uint32_t head = 0;
+    uint32_t reportCount = 0;
+    uint64_t droppedReportCount = 0;
+};
+
 struct OaMetricStreamerImp : MetricStreamer {
-    ~OaMetricStreamerImp() override{};
+    ~OaMetricStreamerImp() override;
 
     ze_result_t readData(uint32_t maxReportCount, size_t *pRawDataSize, uint8_t *pRawData) override;
     ze_result_t close() override;
@@ -25,9 +49,16 @@ struct OaMetricStreamerImp : MetricStreamer {
 
     ze_result_t appendStreamerMarker(CommandList &commandList, uint32_t value) override;
     std::vector<zet_metric_streamer_handle_t> &getMetricStreamers();
+    uint64_t getDroppedReportCount();
+
+    static constexpr uint32_t backgroundReadWaitTimeoutMs = 10;
 
   protected:
     ze_result_t stopMeasurements();
+    void startBackgroundRead(uint32_t capacityInReports);
+    void stopBackgroundRead();
+    void backgroundRead();
+    ze_result_t readBackgroundData(size_t *pRawDataSize, uint8_t *pRawData);
     uint32_t getOaBufferSize(const uint32_t notifyEveryNReports) const;
     uint32_t getNotifyEveryNReports(const uint32_t oaBufferSize) const;
     uint32_t getRequiredBufferSize(const uint32_t maxReportCount) const;
@@ -38,6 +69,15 @@ struct OaMetricStreamerImp : MetricStreamer {
     uint32_t rawReportSize = 0;
     uint32_t oaBufferSize = 0;
     std::vector<zet_metric_streamer_handle_t> metricStreamers;
+
+    // Optional background reader draining oa buffer into reportRing.
+    std::thread backgroundReadThread;
+    std::atomic<bool> backgroundReadActive{false};
+    std::mutex reportRingMutex;
+    OaMetricReportRing reportRing;
+    uint64_t reportedDroppedReportCount = 0;
+    bool ioStreamDroppedData = false;
+    ze_result_t backgroundReadResult = ZE_RESULT_SUCCESS;
 };
 
 } // namespace L0
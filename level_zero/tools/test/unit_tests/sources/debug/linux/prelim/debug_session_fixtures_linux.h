@@ -145,6 +145,7 @@ struct MockDebugSessionLinuxi915 : public L0::DebugSessionLinuxi915 {
     using L0::DebugSessionImp::newAttentionRaised;
     using L0::DebugSessionImp::sipSupportsSlm;
     using L0::DebugSessionImp::stateSaveAreaHeader;
+    using L0::DebugSessionImp::stateSaveAreaMemory;
     using L0::DebugSessionImp::tileAttachEnabled;
     using L0::DebugSessionImp::tileSessions;
     using L0::DebugSessionImp::tileSessionsEnabled;
@@ -322,11 +323,11 @@ struct MockDebugSessionLinuxi915 : public L0::DebugSessionLinuxi915 {
         return L0::DebugSessionLinuxi915::checkThreadIsResumed(threadID);
     }
 
-    bool checkForceExceptionBit(uint64_t memoryHandle, EuThread::ThreadId threadId, uint32_t *cr0, const SIP::regset_desc *regDesc) override {
+    bool checkForceExceptionBit(uint64_t memoryHandle, EuThread::ThreadId threadId, uint32_t *cr0, const SIP::regset_desc *regDesc, const void *stateSaveArea) override {
         if (skipCheckForceExceptionBit) {
             return false;
         }
-        return L0::DebugSessionLinuxi915::checkForceExceptionBit(memoryHandle, threadId, cr0, regDesc);
+        return L0::DebugSessionLinuxi915::checkForceExceptionBit(memoryHandle, threadId, cr0, regDesc, stateSaveArea);
     }
 
     float getThreadStartLimitTime() override {
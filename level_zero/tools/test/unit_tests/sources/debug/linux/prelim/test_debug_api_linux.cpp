@@ -5500,15 +5500,17 @@ TEST_F(DebugApiLinuxTest, GivenStoppedAndRunningThreadWhenCheckStoppedThreadsAnd
     handler->outputBitmask = std::move(bitmask);
 
     sessionMock->checkStoppedThreadsAndGenerateEvents(threads, memoryHandle, 0);
+    EXPECT_EQ(0u, sessionMock->readSystemRoutineIdentCallCount);
+    EXPECT_EQ(2u, sessionMock->readSystemRoutineIdentFromMemoryCallCount);
     if (l0GfxCoreHelper.isThreadControlStoppedSupported()) {
-        EXPECT_EQ(3, handler->ioctlCalled);
+        EXPECT_EQ(2, handler->ioctlCalled);
         EXPECT_EQ(1u, handler->euControlArgs.size());
         EXPECT_EQ(2u, sessionMock->numThreadsPassedToThreadControl);
         EXPECT_EQ(uint32_t(PRELIM_I915_DEBUG_EU_THREADS_CMD_STOPPED), handler->euControlArgs[0].euControl.cmd);
         EXPECT_NE(0u, handler->euControlArgs[0].euControl.bitmask_size);
         EXPECT_NE(0u, handler->euControlArgs[0].euControl.bitmask_ptr);
     } else {
-        EXPECT_EQ(2, handler->ioctlCalled);
+        EXPECT_EQ(1, handler->ioctlCalled);
         EXPECT_EQ(0u, handler->euControlArgs.size());
         EXPECT_EQ(0u, sessionMock->numThreadsPassedToThreadControl);
     }
@@ -5585,6 +5587,69 @@ TEST_F(DebugApiLinuxTest, GivenStoppedThreadResumeCausingPageFaultAndFEBitSetWhe
     EXPECT_EQ(0u, sessionMock->apiEvents.size());
 }
 
+TEST_F(DebugApiLinuxTest, GivenMultipleThreadsAndFEBitSetForOneThreadWhenCheckStoppedThreadsAndGenerateEventsCalledThenStateSaveAreaIsReadOnceAndOnlyThreadWithoutFEBitIsStopped) {
+    zet_debug_config_t config = {};
+    config.pid = 0x1234;
+    const auto memoryHandle = 1u;
+
+    auto sessionMock = std::make_unique<MockDebugSessionLinuxi915>(config, device, 10);
+    ASSERT_NE(nullptr, sessionMock);
+    SIP::version version = {2, 0, 0};
+    initStateSaveArea(sessionMock->stateSaveAreaHeader, version, device);
+
+    auto handler = new MockIoctlHandlerI915;
+    sessionMock->ioctlHandler.reset(handler);
+
+    EuThread::ThreadId thread = {0, 0, 0, 0, 0};
+    EuThread::ThreadId thread1 = {0, 0, 0, 0, 1};
+    std::vector<EuThread::ThreadId> threads;
+    threads.push_back(thread);
+    threads.push_back(thread1);
+
+    for (auto thread : threads) {
+        sessionMock->stoppedThreads[thread.packed] = 3;
+    }
+
+    auto regDesc = sessionMock->typeToRegsetDesc(ZET_DEBUG_REGSET_TYPE_CR_INTEL_GPU);
+    uint32_t cr0[2] = {};
+    cr0[1] = 1 << 26;
+
+    memcpy_s(sessionMock->stateSaveAreaHeader.data() +
+                 threadSlotOffset(reinterpret_cast<SIP::StateSaveAreaHeader *>(sessionMock->stateSaveAreaHeader.data()), thread.slice, thread.subslice, thread.eu, thread.thread) +
+                 regOffsetInThreadSlot(regDesc, 0),
+             regDesc->bytes, cr0, sizeof(cr0));
+
+    handler->setPreadMemory(sessionMock->stateSaveAreaHeader.data(), sessionMock->stateSaveAreaHeader.size(), 0x1000);
+
+    DebugSessionLinuxi915::BindInfo cssaInfo = {0x1000, sessionMock->stateSaveAreaHeader.size()};
+    sessionMock->clientHandleToConnection[MockDebugSessionLinuxi915::mockClientHandle]->vmToContextStateSaveAreaBindInfo[memoryHandle] = cssaInfo;
+
+    std::unique_ptr<uint8_t[]> bitmask;
+    size_t bitmaskSize = 0;
+    auto &hwInfo = neoDevice->getHardwareInfo();
+    auto &l0GfxCoreHelper = neoDevice->getRootDeviceEnvironment().getHelper<L0GfxCoreHelper>();
+    l0GfxCoreHelper.getAttentionBitmaskForSingleThreads(threads, hwInfo, bitmask, bitmaskSize);
+
+    handler->outputBitmaskSize = bitmaskSize;
+    handler->outputBitmask = std::move(bitmask);
+
+    sessionMock->checkStoppedThreadsAndGenerateEvents(threads, memoryHandle, 0);
+
+    const int threadControlIoctls = l0GfxCoreHelper.isThreadControlStoppedSupported() ? 1 : 0;
+    EXPECT_EQ(threadControlIoctls + 1, handler->ioctlCalled);
+    EXPECT_EQ(0u, sessionMock->readSystemRoutineIdentCallCount);
+    EXPECT_EQ(2u, sessionMock->readSystemRoutineIdentFromMemoryCallCount);
+    EXPECT_EQ(sessionMock->stateSaveAreaHeader.size(), sessionMock->stateSaveAreaMemory.size());
+
+    EXPECT_FALSE(sessionMock->allThreads[thread.packed]->isStopped());
+    EXPECT_TRUE(sessionMock->allThreads[thread1.packed]->isStopped());
+
+    EXPECT_EQ(1u, sessionMock->apiEvents.size());
+    auto event = sessionMock->apiEvents.front();
+    EXPECT_EQ(ZET_DEBUG_EVENT_TYPE_THREAD_STOPPED, event.type);
+    EXPECT_EQ(thread1.thread, event.info.thread.thread.thread);
+}
+
 HWTEST2_F(DebugApiLinuxTest, GivenNoAttentionBitsWhenMultipleThreadsPassedToCheckStoppedThreadsAndGenerateEventsThenThreadsStateNotCheckedAndEventsNotGenerated, MatchAny) {
     MockL0GfxCoreHelperSupportsThreadControlStopped<FamilyType> mockL0GfxCoreHelper;
     std::unique_ptr<ApiGfxCoreHelper> l0GfxCoreHelperBackup(static_cast<ApiGfxCoreHelper *>(&mockL0GfxCoreHelper));
@@ -998,6 +998,34 @@ HWTEST2_F(MetricIpSamplingCalculateMetricsTest, GivenEnumerationIsSuccessfulWhen
     }
 }
 
+HWTEST2_F(MetricIpSamplingCalculateMetricsTest, GivenRawDataWithDescendingIpsWhenCalculateMetricValuesIsCalledThenValuesAreReturnedInAscendingIpOrder, IsGen9ToPVC) {
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, testDevices[0]->getMetricDeviceContext().enableMetricApi());
+
+    std::vector<MockStallRawIpData> rawDataReversed(rawDataVector.rbegin(), rawDataVector.rend());
+    std::vector<zet_typed_value_t> metricValues(30);
+
+    for (auto device : testDevices) {
+
+        uint32_t metricGroupCount = 0;
+        zetMetricGroupGet(device->toHandle(), &metricGroupCount, nullptr);
+        std::vector<zet_metric_group_handle_t> metricGroups;
+        metricGroups.resize(metricGroupCount);
+        ASSERT_EQ(zetMetricGroupGet(device->toHandle(), &metricGroupCount, metricGroups.data()), ZE_RESULT_SUCCESS);
+        ASSERT_NE(metricGroups[0], nullptr);
+
+        uint32_t metricValueCount = 30;
+        EXPECT_EQ(zetMetricGroupCalculateMetricValues(metricGroups[0], ZET_METRIC_GROUP_CALCULATION_TYPE_METRIC_VALUES,
+                                                      rawDataVectorSize, reinterpret_cast<uint8_t *>(rawDataReversed.data()), &metricValueCount, metricValues.data()),
+                  ZE_RESULT_SUCCESS);
+        EXPECT_EQ(20u, metricValueCount);
+        for (uint32_t i = 0; i < metricValueCount; i++) {
+            EXPECT_EQ(expectedMetricValues[i].type, metricValues[i].type);
+            EXPECT_EQ(expectedMetricValues[i].value.ui64, metricValues[i].value.ui64);
+        }
+    }
+}
+
 HWTEST2_F(MetricIpSamplingCalculateMetricsTest, GivenEnumerationIsSuccessfulWithBadRawDataSizeWhenCalculateMetricValuesCalculateSizeIsCalledThenErrorUnknownIsReturned, IsGen9ToPVC) {
 
     EXPECT_EQ(ZE_RESULT_SUCCESS, testDevices[0]->getMetricDeviceContext().enableMetricApi());
@@ -9,6 +9,7 @@
 #include "shared/test/common/test_macros/test_base.h"
 
 #include "level_zero/core/source/cmdlist/cmdlist.h"
+#include "level_zero/tools/source/metrics/metric_oa_streamer_imp.h"
 #include "level_zero/tools/test/unit_tests/sources/metrics/mock_metric_oa.h"
 
 namespace L0 {
@@ -367,5 +368,129 @@ TEST_F(MetricStreamerTest, givenValidArgumenteWhenZetMetricStreamerOpenIsCalledT
     EXPECT_EQ(zetMetricStreamerClose(streamerHandle), ZE_RESULT_SUCCESS);
 }
 
+TEST_F(MetricStreamerTest, givenBackgroundReadEnabledWhenZetMetricStreamerReadDataIsCalledThenReportsDrainedByBackgroundReaderAreReturnedAndOverflowIsReported) {
+
+    debugManager.flags.MetricStreamerBackgroundReadReportCount.set(4);
+
+    zet_device_handle_t metricDeviceHandle = device->toHandle();
+    ze_event_handle_t eventHandle = {};
+    zet_metric_streamer_handle_t streamerHandle = {};
+    zet_metric_streamer_desc_t streamerDesc = {};
+    streamerDesc.stype = ZET_STRUCTURE_TYPE_METRIC_STREAMER_DESC;
+    streamerDesc.notifyEveryNReports = 4;
+    streamerDesc.samplingPeriod = 1000;
+    auto &metricOaSource = (static_cast<DeviceImp *>(device))->getMetricDeviceContext().getMetricSource<OaMetricSourceImp>();
+    Mock<MetricGroup> metricGroup(metricOaSource);
+    zet_metric_group_handle_t metricGroupHandle = metricGroup.toHandle();
+    metricsDeviceParams.ConcurrentGroupsCount = 1;
+
+    Mock<IConcurrentGroup_1_13> metricsConcurrentGroup;
+    TConcurrentGroupParams_1_13 metricsConcurrentGroupParams = {};
+    metricsConcurrentGroupParams.MetricSetsCount = 1;
+    metricsConcurrentGroupParams.SymbolName = "OA";
+    metricsConcurrentGroupParams.Description = "OA description";
+    metricsConcurrentGroupParams.IoMeasurementInformationCount = 1;
+
+    Mock<MetricsDiscovery::IEquation_1_0> ioReadEquation;
+    MetricsDiscovery::TEquationElement_1_0 ioEquationElement = {};
+    ioEquationElement.Type = MetricsDiscovery::EQUATION_ELEM_IMM_UINT64;
+    ioEquationElement.ImmediateUInt64 = 0;
+
+    ioReadEquation.getEquationElement.push_back(&ioEquationElement);
+
+    Mock<MetricsDiscovery::IInformation_1_0> ioMeasurement;
+    MetricsDiscovery::TInformationParams_1_0 oaInformation = {};
+    oaInformation.SymbolName = "BufferOverflow";
+    oaInformation.IoReadEquation = &ioReadEquation;
+
+    Mock<MetricsDiscovery::IMetricSet_1_13> metricsSet;
+    MetricsDiscovery::TMetricSetParams_1_11 metricsSetParams = {};
+    metricsSetParams.ApiMask = MetricsDiscovery::API_TYPE_IOSTREAM;
+    metricsSetParams.MetricsCount = 0;
+    metricsSetParams.SymbolName = "Metric set name";
+    metricsSetParams.ShortName = "Metric set description";
+    metricsSetParams.RawReportSize = 256;
+
+    openMetricsAdapter();
+
+    setupDefaultMocksForMetricDevice(metricsDevice);
+
+    metricsDevice.getConcurrentGroupResults.push_back(&metricsConcurrentGroup);
+
+    metricsConcurrentGroup.GetParamsResult = &metricsConcurrentGroupParams;
+    metricsConcurrentGroup.getMetricSetResult = &metricsSet;
+    metricsConcurrentGroup.GetIoMeasurementInformationResult = &ioMeasurement;
+    ioMeasurement.GetParamsResult = &oaInformation;
+
+    metricsSet.GetParamsResult = &metricsSetParams;
+
+    uint32_t metricGroupCount = 0;
+    EXPECT_EQ(zetMetricGroupGet(metricDeviceHandle, &metricGroupCount, nullptr), ZE_RESULT_SUCCESS);
+    EXPECT_EQ(zetMetricGroupGet(metricDeviceHandle, &metricGroupCount, &metricGroupHandle), ZE_RESULT_SUCCESS);
+    EXPECT_NE(metricGroupHandle, nullptr);
+    EXPECT_EQ(zetContextActivateMetricGroups(context->toHandle(), metricDeviceHandle, 1, &metricGroupHandle), ZE_RESULT_SUCCESS);
+    EXPECT_EQ(zetMetricStreamerOpen(context->toHandle(), metricDeviceHandle, metricGroupHandle, &streamerDesc, eventHandle, &streamerHandle), ZE_RESULT_SUCCESS);
+
+    auto streamer = static_cast<OaMetricStreamerImp *>(MetricStreamer::fromHandle(streamerHandle));
+
+    // Mocked io stream always returns full oa buffer (8 reports), so ring of 4 reports overflows.
+    while (streamer->getDroppedReportCount() == 0) {
+        std::this_thread::yield();
+    }
+
+    std::vector<uint8_t> rawData(8 * metricsSetParams.RawReportSize);
+    size_t rawSize = rawData.size();
+    EXPECT_EQ(zetMetricStreamerReadData(streamerHandle, 8, &rawSize, rawData.data()), ZE_RESULT_WARNING_DROPPED_DATA);
+    EXPECT_LE(rawSize, 4u * metricsSetParams.RawReportSize);
+    EXPECT_EQ(0u, rawSize % metricsSetParams.RawReportSize);
+
+    EXPECT_EQ(zetMetricStreamerClose(streamerHandle), ZE_RESULT_SUCCESS);
+}
+
+TEST(OaMetricReportRingTest, givenRingWhenReportsArePushedAndPoppedAcrossEndOfStorageThenReportsAreReturnedInOrder) {
+    OaMetricReportRing ring;
+    ring.initialize(1, 4);
+
+    const uint8_t first[] = {1, 2, 3};
+    ring.push(first, 3);
+
+    uint8_t output[4] = {};
+    EXPECT_EQ(2u, ring.pop(output, 2));
+    EXPECT_EQ(1u, output[0]);
+    EXPECT_EQ(2u, output[1]);
+
+    const uint8_t second[] = {4, 5, 6};
+    ring.push(second, 3);
+    EXPECT_EQ(4u, ring.getReportCount());
+
+    EXPECT_EQ(4u, ring.pop(output, 4));
+    EXPECT_EQ(3u, output[0]);
+    EXPECT_EQ(4u, output[1]);
+    EXPECT_EQ(5u, output[2]);
+    EXPECT_EQ(6u, output[3]);
+    EXPECT_EQ(0u, ring.getReportCount());
+    EXPECT_EQ(0u, ring.getDroppedReportCount());
+}
+
+TEST(OaMetricReportRingTest, givenFullRingWhenReportsArePushedThenOldestReportsAreDroppedAndCounted) {
+    OaMetricReportRing ring;
+    ring.initialize(1, 4);
+
+    const uint8_t first[] = {1, 2, 3};
+    ring.push(first, 3);
+
+    const uint8_t second[] = {4, 5, 6, 7, 8, 9};
+    ring.push(second, 6);
+    EXPECT_EQ(4u, ring.getReportCount());
+    EXPECT_EQ(5u, ring.getDroppedReportCount());
+
+    uint8_t output[4] = {};
+    EXPECT_EQ(4u, ring.pop(output, 4));
+    EXPECT_EQ(6u, output[0]);
+    EXPECT_EQ(7u, output[1]);
+    EXPECT_EQ(8u, output[2]);
+    EXPECT_EQ(9u, output[3]);
+}
+
 } // namespace ult
 } // namespace L0
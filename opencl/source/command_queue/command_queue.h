@@ -10,6 +10,7 @@
 #include "shared/source/helpers/completion_stamp.h"
 #include "shared/source/helpers/engine_node_helper.h"
 #include "shared/source/helpers/map_operation_type.h"
+#include "shared/source/helpers/mt_helpers.h"
 #include "shared/source/helpers/timestamp_packet_container.h"
 #include "shared/source/indirect_heap/indirect_heap_type.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
@@ -23,6 +24,7 @@
 #include "opencl/source/helpers/enqueue_properties.h"
 #include "opencl/source/helpers/properties_helper.h"
 
+#include <atomic>
 #include <cstdint>
 #include <optional>
 
@@ -368,6 +370,9 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     }
     bool isStallingCommandsOnNextFlushRequired() const { return stallingCommandsOnNextFlushRequired; }
 
+    void updateMaxPendingUnblocks(size_t pendingUnblocks) { MultiThreadHelpers::interlockedMax(maxPendingUnblocks, pendingUnblocks); }
+    size_t peekMaxPendingUnblocks() const { return maxPendingUnblocks.load(); }
+
     void setDcFlushRequiredOnStallingCommandsOnNextFlush(const bool isDcFlushRequiredOnStallingCommandsOnNextFlush) { dcFlushRequiredOnStallingCommandsOnNextFlush = isDcFlushRequiredOnStallingCommandsOnNextFlush; }
     bool isDcFlushRequiredOnStallingCommandsOnNextFlush() const { return dcFlushRequiredOnStallingCommandsOnNextFlush; }
 
@@ -502,6 +507,8 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
         TimestampPacketContainer lastSignalledPacket;
     };
     std::array<BcsTimestampPacketContainers, bcsInfoMaskSize> bcsTimestampPacketContainers;
+    // highest number of blocked commands released by a single unblocking pass
+    std::atomic<size_t> maxPendingUnblocks = 0;
     bool stallingCommandsOnNextFlushRequired = false;
     bool dcFlushRequiredOnStallingCommandsOnNextFlush = false;
     bool splitBarrierRequired = false;
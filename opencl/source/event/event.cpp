@@ -38,6 +38,10 @@
 #include <iostream>
 
 namespace NEO {
+
+thread_local std::deque<Event::PendingUnblock> *Event::pendingUnblocks = nullptr;
+thread_local Event *Event::eventUnblockedFromWorklist = nullptr;
+
 Event::Event(
     Context *ctx,
     CommandQueue *cmdQueue,
@@ -595,16 +599,58 @@ void Event::unblockEventsBlockedByThis(int32_t transitionStatus) {
     }
 
     auto childEventRef = childEventsToNotify.detachNodes();
-    while (childEventRef != nullptr) {
-        auto childEvent = childEventRef->ref;
+    if (childEventRef == nullptr) {
+        return;
+    }
+
+    // Unblocking a child may unblock its own children. Instead of recursing through the whole
+    // dependency graph, this call owns a worklist and drains it level by level,
+    // so deep chains of blocked commands are submitted iteratively in topological order.
+    // Only the event being unblocked from that worklist appends its children to it, keeping itself
+    // alive until they are drained; any other event (e.g. a user event set from a callback) drains
+    // its own children before returning. As a result, callbacks of an unblocked event run before
+    // its children are unblocked.
+    bool deferToOuterWorklist = (pendingUnblocks != nullptr) && (eventUnblockedFromWorklist == this);
+    if (deferToOuterWorklist) {
+        while (childEventRef != nullptr) {
+            this->incRefInternal();
+            pendingUnblocks->push_back({childEventRef->ref, this, taskLevelToPropagate, transitionStatus, true});
+            auto next = childEventRef->next;
+            delete childEventRef;
+            childEventRef = next;
+        }
+        return;
+    }
 
-        childEvent->unblockEventBy(*this, taskLevelToPropagate, transitionStatus);
+    std::deque<PendingUnblock> worklist;
+    auto outerWorklist = pendingUnblocks;
+    auto outerUnblockedEvent = eventUnblockedFromWorklist;
+    pendingUnblocks = &worklist;
 
-        childEvent->decRefInternal();
+    while (childEventRef != nullptr) {
+        worklist.push_back({childEventRef->ref, this, taskLevelToPropagate, transitionStatus, false});
         auto next = childEventRef->next;
         delete childEventRef;
         childEventRef = next;
     }
+
+    while (!worklist.empty()) {
+        auto pending = worklist.front();
+        worklist.pop_front();
+
+        if (auto childQueue = pending.childEvent->getCommandQueue()) {
+            childQueue->updateMaxPendingUnblocks(worklist.size() + 1);
+        }
+        eventUnblockedFromWorklist = pending.childEvent;
+        pending.childEvent->unblockEventBy(*pending.parentEvent, pending.taskLevel, pending.transitionStatus);
+        eventUnblockedFromWorklist = outerUnblockedEvent;
+
+        pending.childEvent->decRefInternal();
+        if (pending.parentReferenced) {
+            pending.parentEvent->decRefInternal();
+        }
+    }
+    pendingUnblocks = outerWorklist;
 }
 
 bool Event::setStatus(cl_int status) {
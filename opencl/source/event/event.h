@@ -17,6 +17,7 @@
 
 #include <atomic>
 #include <cstdint>
+#include <deque>
 #include <vector>
 
 namespace NEO {
@@ -355,6 +356,18 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
     // vector storing events that needs to be notified when this event is ready to go
     IFRefList<Event, true, true> childEventsToNotify;
     void unblockEventsBlockedByThis(int32_t transitionStatus);
+
+    struct PendingUnblock {
+        Event *childEvent;
+        Event *parentEvent;
+        TaskCountType taskLevel;
+        int32_t transitionStatus;
+        bool parentReferenced;
+    };
+    // worklist of the unblockEventsBlockedByThis call currently draining on this thread
+    static thread_local std::deque<PendingUnblock> *pendingUnblocks;
+    // event currently being unblocked by that worklist
+    static thread_local Event *eventUnblockedFromWorklist;
     void submitCommand(bool abortBlockedTasks);
 
     static void setExecutionStatusToAbortedDueToGpuHang(cl_event *first, cl_event *last);
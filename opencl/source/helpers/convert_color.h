@@ -10,6 +10,7 @@
 
 #include "CL/cl.h"
 
+#include <cstring>
 #include <utility>
 
 namespace NEO {
@@ -30,16 +31,35 @@ inline int32_t selectNormalizingFactor(const cl_channel_type &channelType) {
     return 0;
 }
 
-inline void convertFillColor(const void *fillColor,
-                             int32_t *iFillColor,
-                             const cl_image_format &oldImageFormat,
-                             const cl_image_format &newImageFormat) {
-    float fFillColor[4] = {0.0f};
+struct FillColorConversionCache {
+    uint32_t fillColor[4] = {};
+    cl_image_format oldImageFormat = {};
+    cl_image_format newImageFormat = {};
+    int32_t iFillColor[4] = {};
+    bool valid = false;
 
-    for (auto i = 0; i < 4; i++) {
-        iFillColor[i] = *((int32_t *)fillColor + i);
-        fFillColor[i] = *((float *)fillColor + i);
+    bool matches(const uint32_t (&color)[4], const cl_image_format &oldFormat, const cl_image_format &newFormat) const {
+        return valid &&
+               memcmp(fillColor, color, sizeof(fillColor)) == 0 &&
+               oldImageFormat.image_channel_order == oldFormat.image_channel_order &&
+               oldImageFormat.image_channel_data_type == oldFormat.image_channel_data_type &&
+               newImageFormat.image_channel_order == newFormat.image_channel_order &&
+               newImageFormat.image_channel_data_type == newFormat.image_channel_data_type;
     }
+};
+
+inline FillColorConversionCache &getFillColorConversionCache() {
+    static thread_local FillColorConversionCache cache;
+    return cache;
+}
+
+inline void convertFillColorUncached(const uint32_t (&fillColor)[4],
+                                     int32_t *iFillColor,
+                                     const cl_image_format &oldImageFormat,
+                                     const cl_image_format &newImageFormat) {
+    float fFillColor[4];
+    memcpy(iFillColor, fillColor, sizeof(fFillColor));
+    memcpy(fFillColor, fillColor, sizeof(fFillColor));
 
     if (oldImageFormat.image_channel_order == CL_A) {
         std::swap(iFillColor[0], iFillColor[3]);
@@ -49,7 +69,8 @@ inline void convertFillColor(const void *fillColor,
         std::swap(fFillColor[0], fFillColor[2]);
     }
 
-    if (oldImageFormat.image_channel_order == CL_sRGBA || oldImageFormat.image_channel_order == CL_sBGRA) {
+    const bool isSrgb = oldImageFormat.image_channel_order == CL_sRGBA || oldImageFormat.image_channel_order == CL_sBGRA;
+    if (isSrgb) {
         for (auto i = 0; i < 3; i++) {
             if (fFillColor[i] != fFillColor[i]) {
                 fFillColor[i] = 0.0f;
@@ -66,38 +87,51 @@ inline void convertFillColor(const void *fillColor,
         }
     }
 
+    int32_t channelMask = 0;
     if (newImageFormat.image_channel_data_type == CL_UNSIGNED_INT8) {
-        auto normalizingFactor = selectNormalizingFactor(oldImageFormat.image_channel_data_type);
-        if (normalizingFactor > 0) {
-            for (auto i = 0; i < 4; i++) {
-                if ((oldImageFormat.image_channel_order == CL_sRGBA || oldImageFormat.image_channel_order == CL_sBGRA) && i < 3) {
-                    iFillColor[i] = static_cast<int32_t>(normalizingFactor * fFillColor[i] + 0.5f);
-                } else {
-                    iFillColor[i] = static_cast<int32_t>(normalizingFactor * fFillColor[i]);
-                }
-            }
-        }
-
-        for (auto i = 0; i < 4; i++) {
-            iFillColor[i] = iFillColor[i] & 0xFF;
-        }
+        channelMask = 0xFF;
     } else if (newImageFormat.image_channel_data_type == CL_UNSIGNED_INT16) {
-        auto normalizingFactor = selectNormalizingFactor(oldImageFormat.image_channel_data_type);
-        if (normalizingFactor > 0) {
-            for (auto i = 0; i < 4; i++) {
-                iFillColor[i] = static_cast<int32_t>(normalizingFactor * fFillColor[i]);
-            }
-        } else if (oldImageFormat.image_channel_data_type == CL_HALF_FLOAT) {
-            // float to half convert.
-            for (auto i = 0; i < 4; i++) {
-                uint16_t temp = Math::float2Half(fFillColor[i]);
-                iFillColor[i] = temp;
-            }
-        }
+        channelMask = 0xFFFF;
+    } else {
+        return;
+    }
 
+    auto normalizingFactor = selectNormalizingFactor(oldImageFormat.image_channel_data_type);
+    if (normalizingFactor > 0) {
+        // sRGB color channels are rounded to nearest, alpha and linear formats are truncated
+        const float rounding = (isSrgb && channelMask == 0xFF) ? 0.5f : 0.0f;
+        for (auto i = 0; i < 3; i++) {
+            iFillColor[i] = static_cast<int32_t>(normalizingFactor * fFillColor[i] + rounding);
+        }
+        iFillColor[3] = static_cast<int32_t>(normalizingFactor * fFillColor[3]);
+    } else if (channelMask == 0xFFFF && oldImageFormat.image_channel_data_type == CL_HALF_FLOAT) {
+        // float to half convert.
         for (auto i = 0; i < 4; i++) {
-            iFillColor[i] = iFillColor[i] & 0xFFFF;
+            iFillColor[i] = Math::float2Half(fFillColor[i]);
         }
     }
+
+    for (auto i = 0; i < 4; i++) {
+        iFillColor[i] &= channelMask;
+    }
+}
+
+inline void convertFillColor(const void *fillColor,
+                             int32_t *iFillColor,
+                             const cl_image_format &oldImageFormat,
+                             const cl_image_format &newImageFormat) {
+    uint32_t fillColorBits[4];
+    memcpy(fillColorBits, fillColor, sizeof(fillColorBits));
+
+    // tiled pipelines fill many images with the same color, so reuse the last conversion done on this thread
+    auto &cache = getFillColorConversionCache();
+    if (!cache.matches(fillColorBits, oldImageFormat, newImageFormat)) {
+        convertFillColorUncached(fillColorBits, cache.iFillColor, oldImageFormat, newImageFormat);
+        memcpy(cache.fillColor, fillColorBits, sizeof(fillColorBits));
+        cache.oldImageFormat = oldImageFormat;
+        cache.newImageFormat = newImageFormat;
+        cache.valid = true;
+    }
+    memcpy(iFillColor, cache.iFillColor, sizeof(cache.iFillColor));
 }
 } // namespace NEO
@@ -0,0 +1,31 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/string.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace NEO {
+
+// Writes fill pattern to pattern allocation, 1 and 2 byte patterns are replicated to full dword
+inline void expandFillPattern(void *dst, const void *pattern, size_t patternSize) {
+    if (patternSize == 1) {
+        uint32_t patternInt = static_cast<uint32_t>(*static_cast<const uint8_t *>(pattern)) * 0x01010101u;
+        memcpy_s(dst, sizeof(uint32_t), &patternInt, sizeof(uint32_t));
+    } else if (patternSize == 2) {
+        uint16_t pattern16 = 0;
+        memcpy_s(&pattern16, sizeof(pattern16), pattern, sizeof(pattern16));
+        uint32_t patternInt = static_cast<uint32_t>(pattern16) * 0x00010001u;
+        memcpy_s(dst, sizeof(uint32_t), &patternInt, sizeof(uint32_t));
+    } else {
+        memcpy_s(dst, patternSize, pattern, patternSize);
+    }
+}
+
+} // namespace NEO
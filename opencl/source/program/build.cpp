@@ -16,6 +16,7 @@
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/addressing_mode_helper.h"
 #include "shared/source/helpers/compiler_options_parser.h"
+#include "shared/source/helpers/hw_info.h"
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/utilities/logger.h"
 
@@ -120,24 +121,43 @@ cl_int Program::build(
             DBG_LOG(LogApiCalls,
                     "Build Options", inputArgs.apiOptions.begin(),
                     "\nBuild Internal Options", inputArgs.internalOptions.begin());
-            NEO::TranslationOutput compilerOuput = {};
+            const auto numDevices = deviceVector.size();
+            std::vector<NEO::TranslationOutput> compilerOutputs(numDevices);
+            std::vector<TranslationOutput::ErrorCode> compilerErrors(numDevices, TranslationOutput::ErrorCode::success);
 
-            for (const auto &clDevice : deviceVector) {
+            std::vector<uint8_t> reusesFrontendOutput(numDevices, 0u);
+
+            // frontend compilation is done once, remaining devices of the same product reuse its intermediate representation
+            compilerErrors[0] = pCompilerInterface->build(deviceVector[0]->getDevice(), inputArgs, compilerOutputs[0]);
+
+            if (numDevices > 1 && compilerErrors[0] == TranslationOutput::ErrorCode::success) {
+                TranslationInput backendInputArgs = inputArgs;
+                const auto &sharedIr = compilerOutputs[0].intermediateRepresentation;
+                if (inputArgs.srcType == IGC::CodeType::oclC && sharedIr.size > 0) {
+                    backendInputArgs.srcType = compilerOutputs[0].intermediateCodeType;
+                    backendInputArgs.src = ArrayRef<const char>(sharedIr.mem.get(), sharedIr.size);
+                }
+
+                for (size_t deviceId = 1; deviceId < numDevices; deviceId++) {
+                    reusesFrontendOutput[deviceId] = isFrontendOutputReusable(*deviceVector[0], *deviceVector[deviceId]);
+                    const auto &deviceInputArgs = reusesFrontendOutput[deviceId] ? backendInputArgs : inputArgs;
+                    compilerErrors[deviceId] = pCompilerInterface->build(deviceVector[deviceId]->getDevice(), deviceInputArgs, compilerOutputs[deviceId]);
+                }
+            }
+
+            for (size_t deviceId = 0; deviceId < numDevices; deviceId++) {
+                const auto &clDevice = deviceVector[deviceId];
+                auto &compilerOuput = compilerOutputs[deviceId];
+                const auto &frontendCompilerLog = reusesFrontendOutput[deviceId] ? compilerOutputs[0].frontendCompilerLog : compilerOuput.frontendCompilerLog;
                 if (requiresRebuild && !shouldSuppressRebuildWarning) {
                     this->updateBuildLog(clDevice->getRootDeviceIndex(), CompilerWarnings::recompiledFromIr.data(), CompilerWarnings::recompiledFromIr.length());
                 }
-                auto compilerErr = pCompilerInterface->build(clDevice->getDevice(), inputArgs, compilerOuput);
-                this->updateBuildLog(clDevice->getRootDeviceIndex(), compilerOuput.frontendCompilerLog.c_str(), compilerOuput.frontendCompilerLog.size());
+                this->updateBuildLog(clDevice->getRootDeviceIndex(), frontendCompilerLog.c_str(), frontendCompilerLog.size());
                 this->updateBuildLog(clDevice->getRootDeviceIndex(), compilerOuput.backendCompilerLog.c_str(), compilerOuput.backendCompilerLog.size());
-                retVal = asClError(compilerErr);
+                retVal = asClError(compilerErrors[deviceId]);
                 if (retVal != CL_SUCCESS) {
                     break;
                 }
-                if (inputArgs.srcType == IGC::CodeType::oclC) {
-                    this->irBinary = std::move(compilerOuput.intermediateRepresentation.mem);
-                    this->irBinarySize = compilerOuput.intermediateRepresentation.size;
-                    this->isSpirV = compilerOuput.intermediateCodeType == IGC::CodeType::spirV;
-                }
                 this->buildInfos[clDevice->getRootDeviceIndex()].debugData = std::move(compilerOuput.debugData.mem);
                 this->buildInfos[clDevice->getRootDeviceIndex()].debugDataSize = compilerOuput.debugData.size;
                 if (BuildPhase::binaryCreation == phaseReached[clDevice->getRootDeviceIndex()]) {
@@ -146,6 +166,11 @@ cl_int Program::build(
                 this->replaceDeviceBinary(std::move(compilerOuput.deviceBinary.mem), compilerOuput.deviceBinary.size, clDevice->getRootDeviceIndex());
                 phaseReached[clDevice->getRootDeviceIndex()] = BuildPhase::binaryCreation;
             }
+            if (compilerErrors[0] == TranslationOutput::ErrorCode::success && inputArgs.srcType == IGC::CodeType::oclC) {
+                this->irBinary = std::move(compilerOutputs[0].intermediateRepresentation.mem);
+                this->irBinarySize = compilerOutputs[0].intermediateRepresentation.size;
+                this->isSpirV = compilerOutputs[0].intermediateCodeType == IGC::CodeType::spirV;
+            }
             if (retVal != CL_SUCCESS) {
                 break;
             }
@@ -224,6 +249,16 @@ void Program::extractInternalOptions(const std::string &options, std::string &in
     }
 }
 
+bool Program::isFrontendOutputReusable(const ClDevice &sourceDevice, const ClDevice &targetDevice) const {
+    const auto &sourceHwInfo = sourceDevice.getHardwareInfo();
+    const auto &targetHwInfo = targetDevice.getHardwareInfo();
+    return sourceHwInfo.platform.eProductFamily == targetHwInfo.platform.eProductFamily &&
+           sourceHwInfo.platform.usRevId == targetHwInfo.platform.usRevId &&
+           sourceHwInfo.ipVersion.value == targetHwInfo.ipVersion.value &&
+           sourceHwInfo.capabilityTable.ftrSupportsFP64 == targetHwInfo.capabilityTable.ftrSupportsFP64 &&
+           sourceDevice.peekCompilerExtensions() == targetDevice.peekCompilerExtensions();
+}
+
 void Program::debugNotify(const ClDeviceVector &deviceVector, std::unordered_map<uint32_t, BuildPhase> &phasesReached) {
     for (auto &clDevice : deviceVector) {
         auto rootDeviceIndex = clDevice->getRootDeviceIndex();
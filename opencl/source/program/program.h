@@ -272,6 +272,7 @@ class Program : public BaseObject<_cl_program> {
     }
 
     MOCKABLE_VIRTUAL void debugNotify(const ClDeviceVector &deviceVector, std::unordered_map<uint32_t, BuildPhase> &phasesReached);
+    bool isFrontendOutputReusable(const ClDevice &sourceDevice, const ClDevice &targetDevice) const;
     void createDebugData(ClDevice *clDevice);
     MOCKABLE_VIRTUAL void createDebugZebin(uint32_t rootDeviceIndex);
     Zebin::Debug::Segments getZebinSegments(uint32_t rootDeviceIndex);
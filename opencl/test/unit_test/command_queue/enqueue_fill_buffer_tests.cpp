@@ -22,6 +22,7 @@
 #include "opencl/source/built_ins/builtins_dispatch_builder.h"
 #include "opencl/source/command_queue/command_queue.h"
 #include "opencl/source/helpers/dispatch_info.h"
+#include "opencl/source/helpers/fill_pattern.h"
 #include "opencl/test/unit_test/command_queue/enqueue_fill_buffer_fixture.h"
 #include "opencl/test/unit_test/command_queue/enqueue_fixture.h"
 #include "opencl/test/unit_test/gen_common/gen_commands_common_validation.h"
@@ -683,3 +684,19 @@ HWTEST_F(EnqueueFillBufferStatefulTest, givenBuffersWhenFillingBufferStatefulThe
 
     ASSERT_EQ(CL_SUCCESS, retVal);
 }
+
+TEST(FillPatternTest, givenOneAndTwoBytePatternsWhenExpandingThenPatternIsReplicatedToDword) {
+    uint32_t dst = 0;
+    uint8_t pattern8 = 0xA5;
+    expandFillPattern(&dst, &pattern8, sizeof(pattern8));
+    EXPECT_EQ(0xA5A5A5A5u, dst);
+
+    uint8_t unalignedStorage[3] = {0x00, 0x34, 0x12};
+    expandFillPattern(&dst, &unalignedStorage[1], sizeof(uint16_t));
+    EXPECT_EQ(0x12341234u, dst);
+
+    uint8_t pattern[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    uint8_t dstPattern[8] = {};
+    expandFillPattern(dstPattern, pattern, sizeof(pattern));
+    EXPECT_EQ(0, memcmp(pattern, dstPattern, sizeof(pattern)));
+}
@@ -298,3 +298,52 @@ TEST(ColorConvertTest, givenSnorm16FormatWhenConvertingThenUseNormalizingFactor)
 
     EXPECT_TRUE(memcmp(expectedIFillColor, iFillColor, 4 * sizeof(int32_t)) == 0);
 }
+
+TEST(ColorConvertTest, givenSameColorConvertedForDifferentFormatsThenEachConversionUsesItsOwnFormat) {
+    float fFillColor[4] = {0.5f, 0.25f, 0.0f, 1.0f};
+    int32_t iFillColor8[4] = {};
+    int32_t iFillColor16[4] = {};
+
+    cl_image_format oldFormat8 = {CL_RGBA, CL_UNORM_INT8};
+    cl_image_format newFormat8 = {CL_RGBA, CL_UNSIGNED_INT8};
+    cl_image_format oldFormat16 = {CL_RGBA, CL_UNORM_INT16};
+    cl_image_format newFormat16 = {CL_RGBA, CL_UNSIGNED_INT16};
+
+    convertFillColor(static_cast<const void *>(fFillColor), iFillColor8, oldFormat8, newFormat8);
+    convertFillColor(static_cast<const void *>(fFillColor), iFillColor16, oldFormat16, newFormat16);
+
+    int32_t expectedIFillColor8[4] = {127, 63, 0, 255};
+    int32_t expectedIFillColor16[4] = {32767, 16383, 0, 65535};
+    EXPECT_EQ(0, memcmp(expectedIFillColor8, iFillColor8, sizeof(iFillColor8)));
+    EXPECT_EQ(0, memcmp(expectedIFillColor16, iFillColor16, sizeof(iFillColor16)));
+
+    convertFillColor(static_cast<const void *>(fFillColor), iFillColor8, oldFormat8, newFormat8);
+    EXPECT_EQ(0, memcmp(expectedIFillColor8, iFillColor8, sizeof(iFillColor8)));
+}
+
+TEST(ColorConvertTest, givenRepeatedConversionOfSameColorWhenConvertingThenCachedResultIsReturned) {
+    float fFillColor[4] = {0.5f, 0.25f, 0.0f, 1.0f};
+    float otherFillColor[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+    int32_t iFillColor[4] = {};
+
+    cl_image_format oldFormat = {CL_sRGBA, CL_UNORM_INT8};
+    cl_image_format newFormat = {CL_RGBA, CL_UNSIGNED_INT8};
+
+    convertFillColor(static_cast<const void *>(fFillColor), iFillColor, oldFormat, newFormat);
+    auto &cache = getFillColorConversionCache();
+    EXPECT_TRUE(cache.valid);
+    EXPECT_EQ(0, memcmp(cache.fillColor, fFillColor, sizeof(fFillColor)));
+
+    int32_t cachedFillColor[4] = {};
+    memcpy(cachedFillColor, iFillColor, sizeof(iFillColor));
+    cache.iFillColor[0] = 0x12;
+
+    convertFillColor(static_cast<const void *>(fFillColor), iFillColor, oldFormat, newFormat);
+    EXPECT_EQ(0x12, iFillColor[0]);
+
+    convertFillColor(static_cast<const void *>(otherFillColor), iFillColor, oldFormat, newFormat);
+    EXPECT_EQ(0, memcmp(cache.fillColor, otherFillColor, sizeof(otherFillColor)));
+
+    convertFillColor(static_cast<const void *>(fFillColor), iFillColor, oldFormat, newFormat);
+    EXPECT_EQ(0, memcmp(cachedFillColor, iFillColor, sizeof(iFillColor)));
+}
@@ -274,6 +274,75 @@ TEST_F(EventTests, givenNormalEventThatHasParentUserEventWhenUserEventIsUnblocke
     EXPECT_EQ(CL_COMPLETE, event.peekExecutionStatus());
 }
 
+TEST_F(EventTests, givenDeepChainOfEventsBlockedByUserEventWhenUserEventIsUnblockedThenWholeChainIsCompleted) {
+    constexpr size_t chainLength = 10000;
+    UserEvent uEvent;
+    std::vector<std::unique_ptr<Event>> chain;
+    for (size_t i = 0; i < chainLength; i++) {
+        chain.push_back(std::make_unique<Event>(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, 0, 0));
+        Event &parent = (i == 0) ? static_cast<Event &>(uEvent) : *chain[i - 1];
+        parent.addChild(*chain[i]);
+    }
+
+    EXPECT_EQ(CL_QUEUED, chain.back()->peekExecutionStatus());
+
+    uEvent.setStatus(CL_COMPLETE);
+    for (auto &event : chain) {
+        EXPECT_EQ(CL_COMPLETE, event->peekExecutionStatus());
+        EXPECT_FALSE(event->peekHasChildEvents());
+    }
+    EXPECT_EQ(1u, pCmdQ->peekMaxPendingUnblocks());
+}
+
+TEST_F(EventTests, givenWideGraphOfEventsBlockedByUserEventWhenUserEventIsUnblockedThenAllChildrenAreReleasedInOnePass) {
+    constexpr size_t graphWidth = 64;
+    UserEvent uEvent;
+    std::vector<std::unique_ptr<Event>> children;
+    for (size_t i = 0; i < graphWidth; i++) {
+        children.push_back(std::make_unique<Event>(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, 0, 0));
+        uEvent.addChild(*children.back());
+    }
+    EXPECT_EQ(0u, pCmdQ->peekMaxPendingUnblocks());
+
+    uEvent.setStatus(CL_COMPLETE);
+    for (auto &event : children) {
+        EXPECT_EQ(CL_COMPLETE, event->peekExecutionStatus());
+    }
+    EXPECT_EQ(graphWidth, pCmdQ->peekMaxPendingUnblocks());
+}
+
+TEST_F(EventTests, givenCallbackOfUnblockedEventSettingOtherUserEventStatusWhenCallbackReturnsThenChildrenOfOtherUserEventAreAlreadyUnblocked) {
+    DebugManagerStateRestore dbgRestore;
+    debugManager.flags.EnableAsyncEventsHandler.set(false);
+    struct ClbData {
+        UserEvent *otherUserEvent;
+        Event *otherChild;
+        int32_t otherChildStatus;
+    };
+    struct HelperClb {
+        static void CL_CALLBACK setOtherUserEventStatus(cl_event e, cl_int status, void *data) {
+            auto clbData = static_cast<ClbData *>(data);
+            clbData->otherUserEvent->setStatus(CL_COMPLETE);
+            clbData->otherChildStatus = clbData->otherChild->peekExecutionStatus();
+        }
+    };
+
+    UserEvent uEvent;
+    UserEvent otherUserEvent;
+    Event child(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, 0, 0);
+    Event otherChild(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, 0, 0);
+    uEvent.addChild(child);
+    otherUserEvent.addChild(otherChild);
+
+    ClbData clbData = {&otherUserEvent, &otherChild, CL_QUEUED};
+    child.addCallback(HelperClb::setOtherUserEventStatus, CL_SUBMITTED, &clbData);
+
+    uEvent.setStatus(CL_COMPLETE);
+    EXPECT_EQ(CL_COMPLETE, clbData.otherChildStatus);
+    EXPECT_EQ(CL_COMPLETE, child.peekExecutionStatus());
+    EXPECT_FALSE(otherUserEvent.peekHasChildEvents());
+}
+
 TEST_F(MockEventTests, WhenAddingTwoChildEventsThenConnectionIsCreatedAndCountOnReturnEventIsInjected) {
     uEvent = makeReleaseable<UserEvent>();
     auto uEvent2 = makeReleaseable<UserEvent>();
@@ -3265,6 +3265,74 @@ TEST_F(ProgramMultiRootDeviceTests, WhenProgramIsCreatedThenBuildInfosVectorIsPr
     }
 }
 
+class MockCompilerInterfaceCaptureSourceTypes : public CompilerInterface {
+  public:
+    TranslationOutput::ErrorCode build(const NEO::Device &device, const TranslationInput &input, TranslationOutput &output) override {
+        receivedSourceTypes[device.getRootDeviceIndex()] = input.srcType;
+        if (input.srcType == IGC::CodeType::oclC) {
+            output.intermediateCodeType = IGC::CodeType::spirV;
+            output.intermediateRepresentation.mem = makeCopy(spirv, sizeof(spirv));
+            output.intermediateRepresentation.size = sizeof(spirv);
+            output.frontendCompilerLog = "frontend log";
+        } else {
+            EXPECT_EQ(sizeof(spirv), input.src.size());
+            EXPECT_EQ(0, memcmp(spirv, input.src.begin(), sizeof(spirv)));
+        }
+        output.backendCompilerLog = "backend log " + std::to_string(device.getRootDeviceIndex());
+        return TranslationOutput::ErrorCode::success;
+    }
+
+    static constexpr char spirv[] = {0x03, 0x02, 0x23, 0x07};
+    std::map<uint32_t, IGC::CodeType::CodeType_t> receivedSourceTypes;
+};
+
+TEST_F(ProgramMultiRootDeviceTests, givenProgramFromSourceWhenBuildingForMultipleRootDevicesThenFrontendIsCalledOnceAndOtherDevicesReuseIr) {
+    auto cip = new MockCompilerInterfaceCaptureSourceTypes();
+    device1->getExecutionEnvironment()->rootDeviceEnvironments[device1->getRootDeviceIndex()]->compilerInterface.reset(cip);
+
+    ClDeviceVector deviceVector;
+    deviceVector.push_back(device1);
+    deviceVector.push_back(device2);
+    auto program = std::make_unique<SucceedingGenBinaryProgram>(context.get(), false, deviceVector);
+    program->sourceCode = "__kernel mock() {}";
+    program->createdFrom = Program::CreatedFrom::source;
+
+    EXPECT_EQ(CL_SUCCESS, program->build(deviceVector, nullptr));
+
+    ASSERT_EQ(2u, cip->receivedSourceTypes.size());
+    EXPECT_EQ(IGC::CodeType::oclC, cip->receivedSourceTypes[device1->getRootDeviceIndex()]);
+    EXPECT_EQ(IGC::CodeType::spirV, cip->receivedSourceTypes[device2->getRootDeviceIndex()]);
+
+    EXPECT_TRUE(program->getIsSpirV());
+    EXPECT_EQ(sizeof(MockCompilerInterfaceCaptureSourceTypes::spirv), program->irBinarySize);
+    EXPECT_STREQ("frontend log\nbackend log 1", program->getBuildLog(device1->getRootDeviceIndex()));
+    EXPECT_STREQ("frontend log\nbackend log 2", program->getBuildLog(device2->getRootDeviceIndex()));
+}
+
+TEST_F(ProgramMultiRootDeviceTests, givenProgramFromSourceAndRootDevicesOfDifferentProductsWhenBuildingThenFrontendIsCalledForEachDevice) {
+    auto &hwInfo2 = *device2->getExecutionEnvironment()->rootDeviceEnvironments[device2->getRootDeviceIndex()]->getMutableHardwareInfo();
+    VariableBackup<PRODUCT_FAMILY> productFamilyBackup{&hwInfo2.platform.eProductFamily, IGFX_UNKNOWN};
+    ASSERT_NE(device1->getHardwareInfo().platform.eProductFamily, device2->getHardwareInfo().platform.eProductFamily);
+
+    auto cip = new MockCompilerInterfaceCaptureSourceTypes();
+    device1->getExecutionEnvironment()->rootDeviceEnvironments[device1->getRootDeviceIndex()]->compilerInterface.reset(cip);
+
+    ClDeviceVector deviceVector;
+    deviceVector.push_back(device1);
+    deviceVector.push_back(device2);
+    auto program = std::make_unique<SucceedingGenBinaryProgram>(context.get(), false, deviceVector);
+    program->sourceCode = "__kernel mock() {}";
+    program->createdFrom = Program::CreatedFrom::source;
+
+    EXPECT_EQ(CL_SUCCESS, program->build(deviceVector, nullptr));
+
+    ASSERT_EQ(2u, cip->receivedSourceTypes.size());
+    EXPECT_EQ(IGC::CodeType::oclC, cip->receivedSourceTypes[device1->getRootDeviceIndex()]);
+    EXPECT_EQ(IGC::CodeType::oclC, cip->receivedSourceTypes[device2->getRootDeviceIndex()]);
+    EXPECT_STREQ("frontend log\nbackend log 1", program->getBuildLog(device1->getRootDeviceIndex()));
+    EXPECT_STREQ("frontend log\nbackend log 2", program->getBuildLog(device2->getRootDeviceIndex()));
+}
+
 class MockCompilerInterfaceWithGtpinParam : public CompilerInterface {
   public:
     TranslationOutput::ErrorCode link(
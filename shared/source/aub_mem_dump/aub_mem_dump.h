@@ -8,12 +8,17 @@
 #pragma once
 #include "shared/source/aub_mem_dump/aub_data.h"
 
+#include <condition_variable>
+#include <deque>
 #include <fstream>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
 
 namespace NEO {
 class AubHelper;
+class Thread;
 }
 
 namespace AubMemDump {
@@ -120,6 +125,7 @@ struct AubStream {
 };
 
 struct AubFileStream : public AubStream {
+    ~AubFileStream() override;
     void open(const char *filePath) override;
     void close() override;
     bool init(uint32_t stepping, uint32_t device) override;
@@ -139,10 +145,32 @@ struct AubFileStream : public AubStream {
                                        uint32_t addressSpace, uint32_t compareOperation);
     MOCKABLE_VIRTUAL bool addComment(const char *message);
     [[nodiscard]] MOCKABLE_VIRTUAL std::unique_lock<std::mutex> lockStream();
+    bool isAsyncWriterActive() const { return asyncWriterThread != nullptr; }
 
     std::ofstream fileHandle;
     std::string fileName;
     std::mutex mutex;
+
+  protected:
+    MOCKABLE_VIRTUAL void writeToFile(const char *data, size_t size);
+    static void *asyncWriterRun(void *self);
+    void startAsyncWriter();
+    void stopAsyncWriter();
+    void submitSegment();
+    void waitForPendingSegments();
+
+    static constexpr size_t asyncWriterSegmentSize = 4 * 1024 * 1024;
+    static constexpr size_t asyncWriterDefaultMaxPendingBytes = 64 * 1024 * 1024;
+
+    std::unique_ptr<NEO::Thread> asyncWriterThread;
+    std::vector<char> currentSegment;
+    std::deque<std::vector<char>> pendingSegments;
+    std::mutex segmentsMutex;
+    std::condition_variable segmentsCondition;
+    size_t pendingBytes = 0;
+    size_t maxPendingBytes = asyncWriterDefaultMaxPendingBytes;
+    bool asyncWriterBusy = false;
+    bool asyncWriterStop = false;
 };
 
 template <int addressingBits>
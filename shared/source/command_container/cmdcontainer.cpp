@@ -469,8 +469,8 @@ GraphicsAllocation *CommandContainer::reuseExistingCmdBuffer(bool forceHostMemor
     forceHostMemory &= this->useSecondaryCommandStream;
     size_t alignedSize = getAlignedCmdBufferSize();
     auto cmdBufferAllocation = this->immediateReusableAllocationList->detachAllocation(alignedSize, nullptr, forceHostMemory, this->immediateCmdListCsr, AllocationType::commandBuffer).release();
-    if (!cmdBufferAllocation) {
-        this->reusableAllocationList->detachAllocation(alignedSize, nullptr, forceHostMemory, this->immediateCmdListCsr, AllocationType::commandBuffer).release();
+    if (!cmdBufferAllocation && this->reusableAllocationList) {
+        cmdBufferAllocation = this->reusableAllocationList->detachAllocation(alignedSize, nullptr, forceHostMemory, this->immediateCmdListCsr, AllocationType::commandBuffer).release();
     }
 
     if (cmdBufferAllocation) {
@@ -129,6 +129,9 @@ struct EncodeDispatchKernel {
     template <typename WalkerType>
     static void encode(CommandContainer &container, EncodeDispatchKernelArgs &args);
 
+    template <typename WalkerType>
+    static void encodeKernelInvariantWalkerFields(WalkerType &walkerCmd, const EncodeDispatchKernelArgs &args, PreemptionMode preemptionMode);
+
     template <typename WalkerType>
     static void encodeAdditionalWalkerFields(const RootDeviceEnvironment &rootDeviceEnvironment, WalkerType &walkerCmd, const EncodeWalkerArgs &walkerArgs);
 
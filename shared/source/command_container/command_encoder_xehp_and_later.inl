@@ -30,6 +30,7 @@
 #include "shared/source/helpers/simd_helper.h"
 #include "shared/source/helpers/state_base_address.h"
 #include "shared/source/kernel/dispatch_kernel_encoder_interface.h"
+#include "shared/source/kernel/dispatch_walker_template.h"
 #include "shared/source/kernel/implicit_args_helper.h"
 #include "shared/source/kernel/kernel_descriptor.h"
 #include "shared/source/os_interface/product_helper.h"
@@ -56,7 +57,6 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
 
     const auto &kernelDescriptor = args.dispatchInterface->getKernelDescriptor();
     auto sizeCrossThreadData = args.dispatchInterface->getCrossThreadDataSize();
-    auto sizePerThreadData = args.dispatchInterface->getPerThreadDataSize();
     auto sizePerThreadDataForWholeGroup = args.dispatchInterface->getPerThreadDataSizeForWholeThreadGroup();
     auto pImplicitArgs = args.dispatchInterface->getImplicitArgs();
 
@@ -81,8 +81,8 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
     WalkerType walkerCmd = Family::template getInitGpuWalker<WalkerType>();
     auto &idd = walkerCmd.getInterfaceDescriptor();
 
-    EncodeDispatchKernel<Family>::setGrfInfo(&idd, kernelDescriptor.kernelAttributes.numGrfRequired, sizeCrossThreadData,
-                                             sizePerThreadData, rootDeviceEnvironment);
+    auto preemptionMode = args.device->getDebugger() ? PreemptionMode::ThreadGroup : args.preemptionMode;
+    EncodeDispatchKernel<Family>::template encodeKernelInvariantWalkerFields<WalkerType>(walkerCmd, args, preemptionMode);
 
     bool localIdsGenerationByRuntime = args.dispatchInterface->requiresGenerationOfLocalIdsByRuntime();
     auto requiredWorkgroupOrder = args.dispatchInterface->getRequiredWorkgroupOrder();
@@ -103,19 +103,10 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
         }
         idd.setKernelStartPointer(kernelStartPointer);
     }
-    if (args.dispatchInterface->getKernelDescriptor().kernelAttributes.flags.usesAssert && args.device->getL0Debugger() != nullptr) {
-        idd.setSoftwareExceptionEnable(1);
-    }
 
     auto threadsPerThreadGroup = args.dispatchInterface->getNumThreadsPerThreadGroup();
     idd.setNumberOfThreadsInGpgpuThreadGroup(threadsPerThreadGroup);
 
-    EncodeDispatchKernel<Family>::programBarrierEnable(idd,
-                                                       kernelDescriptor,
-                                                       hwInfo);
-
-    EncodeDispatchKernel<Family>::encodeEuSchedulingPolicy(&idd, kernelDescriptor, args.defaultPipelinedThreadArbitrationPolicy);
-
     auto slmSize = EncodeDispatchKernel<Family>::computeSlmValues(hwInfo, args.dispatchInterface->getSlmTotalSize());
 
     if (debugManager.flags.OverrideSlmAllocationSize.get() != -1) {
@@ -180,9 +171,6 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
         }
     }
 
-    auto preemptionMode = args.device->getDebugger() ? PreemptionMode::ThreadGroup : args.preemptionMode;
-    PreemptionHelper::programInterfaceDescriptorDataPreemption<Family>(&idd, preemptionMode);
-
     uint32_t samplerCount = 0;
 
     if constexpr (Family::supportsSampler) {
@@ -472,6 +460,47 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
     }
 }
 
+template <typename Family>
+template <typename WalkerType>
+void EncodeDispatchKernel<Family>::encodeKernelInvariantWalkerFields(WalkerType &walkerCmd, const EncodeDispatchKernelArgs &args, PreemptionMode preemptionMode) {
+    const auto &kernelDescriptor = args.dispatchInterface->getKernelDescriptor();
+    const bool l0DebuggerActive = args.device->getL0Debugger() != nullptr;
+
+    const DispatchWalkerTemplateKey templateKey{
+        args.device,                                               // device
+        args.defaultPipelinedThreadArbitrationPolicy,              // defaultThreadArbitrationPolicy
+        kernelDescriptor.kernelAttributes.threadArbitrationPolicy, // kernelThreadArbitrationPolicy
+        preemptionMode,                                            // preemptionMode
+        l0DebuggerActive,                                          // l0DebuggerActive
+        Family::template isHeaplessMode<WalkerType>()};            // heaplessMode
+
+    auto walkerTemplate = args.dispatchInterface->getDispatchWalkerTemplate();
+    if (walkerTemplate && walkerTemplate->load(templateKey, &walkerCmd, sizeof(WalkerType))) {
+        return;
+    }
+
+    auto &idd = walkerCmd.getInterfaceDescriptor();
+
+    EncodeDispatchKernel<Family>::setGrfInfo(&idd, kernelDescriptor.kernelAttributes.numGrfRequired, args.dispatchInterface->getCrossThreadDataSize(),
+                                             args.dispatchInterface->getPerThreadDataSize(), args.device->getRootDeviceEnvironment());
+
+    if (kernelDescriptor.kernelAttributes.flags.usesAssert && l0DebuggerActive) {
+        idd.setSoftwareExceptionEnable(1);
+    }
+
+    EncodeDispatchKernel<Family>::programBarrierEnable(idd,
+                                                       kernelDescriptor,
+                                                       args.device->getHardwareInfo());
+
+    EncodeDispatchKernel<Family>::encodeEuSchedulingPolicy(&idd, kernelDescriptor, args.defaultPipelinedThreadArbitrationPolicy);
+
+    PreemptionHelper::programInterfaceDescriptorDataPreemption<Family>(&idd, preemptionMode);
+
+    if (walkerTemplate) {
+        walkerTemplate->store(templateKey, &walkerCmd, sizeof(WalkerType));
+    }
+}
+
 template <typename Family>
 template <typename WalkerType>
 void EncodeDispatchKernel<Family>::setupPostSyncForRegularEvent(WalkerType &walkerCmd, const EncodeDispatchKernelArgs &args) {
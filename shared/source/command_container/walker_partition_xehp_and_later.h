@@ -18,8 +18,10 @@
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/helpers/string.h"
 
+#include <array>
 #include <cassert>
 #include <optional>
+#include <utility>
 
 namespace NEO {
 struct PipeControlArgs;
@@ -72,6 +74,41 @@ inline void *putCommand(void *&inputAddress, uint32_t &totalBytesProgrammed, siz
     return commandToReturn;
 }
 
+// Selects dimension with the lowest fraction of idle workgroup slots when split into partitionCount parts.
+// Deeper dimensions win ties, dimensions with a single workgroup are not considered.
+template <typename WalkerType>
+typename WalkerType::PARTITION_TYPE selectPartitionTypeWithLowestImbalance(uint32_t partitionCount,
+                                                                            const Vec3<size_t> &groupCount,
+                                                                            size_t *outWorkgroupCount) {
+    using PARTITION_TYPE = typename WalkerType::PARTITION_TYPE;
+
+    const std::array<std::pair<PARTITION_TYPE, size_t>, 3> candidates = {{{PARTITION_TYPE::PARTITION_TYPE_Z, groupCount.z},
+                                                                          {PARTITION_TYPE::PARTITION_TYPE_Y, groupCount.y},
+                                                                          {PARTITION_TYPE::PARTITION_TYPE_X, groupCount.x}}};
+
+    auto selectedPartitionType = PARTITION_TYPE::PARTITION_TYPE_X;
+    size_t selectedWorkgroupCount = groupCount.x;
+    size_t selectedIdleSlots = 0u;
+    bool candidateFound = false;
+
+    for (const auto &[partitionType, workgroupCount] : candidates) {
+        if (workgroupCount <= 1u) {
+            continue;
+        }
+        const size_t idleSlots = (partitionCount - workgroupCount % partitionCount) % partitionCount;
+        // compare idleSlots / workgroupCount fractions without division
+        if (!candidateFound || idleSlots * selectedWorkgroupCount < selectedIdleSlots * workgroupCount) {
+            selectedPartitionType = partitionType;
+            selectedWorkgroupCount = workgroupCount;
+            selectedIdleSlots = idleSlots;
+            candidateFound = true;
+        }
+    }
+
+    *outWorkgroupCount = selectedWorkgroupCount;
+    return selectedPartitionType;
+}
+
 template <typename GfxFamily, typename WalkerType>
 uint32_t computePartitionCountAndPartitionType(uint32_t preferredMinimalPartitionCount,
                                                bool preferStaticPartitioning,
@@ -112,6 +149,9 @@ uint32_t computePartitionCountAndPartitionType(uint32_t preferredMinimalPartitio
         }
         *outSelectedPartitionType = requestedPartitionType.value();
         disablePartitionForPartitionCountOne = false;
+    } else if (NEO::debugManager.flags.WalkerPartitionSelectDimensionByImbalance.get() == 1) {
+        *outSelectedPartitionType = selectPartitionTypeWithLowestImbalance<WalkerType>(std::max(preferredMinimalPartitionCount, 1u), groupCount, &workgroupCount);
+        disablePartitionForPartitionCountOne = true;
     } else {
         const size_t maxDimension = std::max({groupCount.z, groupCount.y, groupCount.x});
 
@@ -17,6 +17,7 @@
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/options.h"
 #include "shared/source/os_interface/os_inc_base.h"
+#include "shared/source/os_interface/os_thread.h"
 #include "shared/source/os_interface/sys_calls_common.h"
 #include "shared/source/release_helper/release_helper.h"
 
@@ -95,24 +96,117 @@ static auto sizeMemoryWriteHeader = sizeof(CmdServicesMemTraceMemoryWrite) - siz
 
 extern const size_t dwordCountMax;
 
+AubFileStream::~AubFileStream() {
+    stopAsyncWriter();
+}
+
 void AubFileStream::open(const char *filePath) {
     fileHandle.open(filePath, std::ofstream::binary);
     fileName.assign(filePath);
+    if (fileHandle.is_open() && NEO::debugManager.flags.EnableAsyncAubFileWriter.get() == 1) {
+        startAsyncWriter();
+    }
 }
 
 void AubFileStream::close() {
+    stopAsyncWriter();
     fileHandle.close();
     fileName.clear();
 }
 
 void AubFileStream::write(const char *data, size_t size) {
+    if (asyncWriterThread) {
+        currentSegment.insert(currentSegment.end(), data, data + size);
+        if (currentSegment.size() >= asyncWriterSegmentSize) {
+            submitSegment();
+        }
+        return;
+    }
+    writeToFile(data, size);
+}
+
+void AubFileStream::writeToFile(const char *data, size_t size) {
     fileHandle.write(data, size);
 }
 
 void AubFileStream::flush() {
+    if (asyncWriterThread) {
+        submitSegment();
+        waitForPendingSegments();
+    }
+    fileHandle.flush();
+}
+
+void AubFileStream::startAsyncWriter() {
+    maxPendingBytes = asyncWriterDefaultMaxPendingBytes;
+    if (NEO::debugManager.flags.AsyncAubFileWriterMaxPendingBytes.get() > 0) {
+        maxPendingBytes = static_cast<size_t>(NEO::debugManager.flags.AsyncAubFileWriterMaxPendingBytes.get());
+    }
+    asyncWriterStop = false;
+    currentSegment.reserve(asyncWriterSegmentSize);
+    asyncWriterThread = NEO::Thread::createFunc(asyncWriterRun, reinterpret_cast<void *>(this));
+}
+
+void AubFileStream::stopAsyncWriter() {
+    if (!asyncWriterThread) {
+        return;
+    }
+    submitSegment();
+    {
+        std::lock_guard<std::mutex> lock(segmentsMutex);
+        asyncWriterStop = true;
+    }
+    segmentsCondition.notify_all();
+    asyncWriterThread->join();
+    asyncWriterThread.reset();
+    std::vector<char>().swap(currentSegment);
     fileHandle.flush();
 }
 
+void AubFileStream::submitSegment() {
+    if (currentSegment.empty()) {
+        return;
+    }
+    {
+        std::unique_lock<std::mutex> lock(segmentsMutex);
+        // bound memory held by capture: stall producer until writer catches up
+        segmentsCondition.wait(lock, [this] { return pendingBytes == 0 || pendingBytes + currentSegment.size() <= maxPendingBytes; });
+        pendingBytes += currentSegment.size();
+        pendingSegments.push_back(std::move(currentSegment));
+    }
+    segmentsCondition.notify_all();
+    currentSegment = std::vector<char>();
+    currentSegment.reserve(asyncWriterSegmentSize);
+}
+
+void AubFileStream::waitForPendingSegments() {
+    std::unique_lock<std::mutex> lock(segmentsMutex);
+    segmentsCondition.wait(lock, [this] { return pendingSegments.empty() && !asyncWriterBusy; });
+}
+
+void *AubFileStream::asyncWriterRun(void *self) {
+    auto stream = reinterpret_cast<AubFileStream *>(self);
+    std::unique_lock<std::mutex> lock(stream->segmentsMutex);
+    while (true) {
+        stream->segmentsCondition.wait(lock, [stream] { return stream->asyncWriterStop || !stream->pendingSegments.empty(); });
+        if (stream->pendingSegments.empty()) {
+            break;
+        }
+        auto segment = std::move(stream->pendingSegments.front());
+        stream->pendingSegments.pop_front();
+        stream->asyncWriterBusy = true;
+
+        lock.unlock();
+        stream->writeToFile(segment.data(), segment.size());
+        lock.lock();
+
+        stream->pendingBytes -= segment.size();
+        stream->asyncWriterBusy = false;
+        stream->segmentsCondition.notify_all();
+    }
+    return nullptr;
+}
+
 bool AubFileStream::init(uint32_t stepping, uint32_t device) {
     CmdServicesMemTraceVersion header = {};
 
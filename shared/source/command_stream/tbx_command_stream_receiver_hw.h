@@ -13,6 +13,9 @@
 #include "shared/source/memory_manager/page_table.h"
 
 #include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace NEO {
 
@@ -43,6 +46,15 @@ class TbxCommandStreamReceiverHw : public CommandStreamReceiverSimulatedHw<GfxFa
     void protectCPUMemoryAccessIfTbxFaultable(GraphicsAllocation *gfxAllocation, void *cpuAddress, size_t size);
     void protectCPUMemoryFromWritesIfTbxFaultable(GraphicsAllocation *gfxAllocation, void *cpuAddress, size_t size);
 
+    struct UploadedPagesState {
+        uint64_t gpuAddress = 0;
+        size_t size = 0;
+        std::vector<uint64_t> pageHashes;
+    };
+    bool isDeltaUploadEnabled() const;
+    std::vector<std::pair<size_t, size_t>> getDirtyRangesForUpload(GraphicsAllocation &gfxAllocation, uint64_t gpuAddress, const void *cpuAddress, size_t size);
+    void updateUploadedPagesState(GraphicsAllocation &gfxAllocation, uint64_t gpuAddress, const void *cpuAddress, size_t size);
+
   public:
     using CommandStreamReceiverSimulatedCommonHw<GfxFamily>::initAdditionalMMIO;
     using CommandStreamReceiverSimulatedCommonHw<GfxFamily>::aubManager;
@@ -106,6 +118,9 @@ class TbxCommandStreamReceiverHw : public CommandStreamReceiverSimulatedHw<GfxFa
     AddressMapper gttRemap;
 
     std::set<GraphicsAllocation *> allocationsForDownload = {};
+    std::unordered_map<GraphicsAllocation *, UploadedPagesState> uploadedPagesStates;
+    uint64_t deltaUploadSkippedBytes = 0;
+    uint64_t deltaUploadWrittenBytes = 0;
 
     CommandStreamReceiverType getType() const override {
         return CommandStreamReceiverType::tbx;
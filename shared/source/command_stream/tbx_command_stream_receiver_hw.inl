@@ -20,10 +20,12 @@
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/api_specific_config.h"
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/engine_node_helper.h"
 #include "shared/source/helpers/gfx_core_helper.h"
+#include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/allocation_type.h"
@@ -510,7 +512,16 @@ bool TbxCommandStreamReceiverHw<GfxFamily>::writeMemory(GraphicsAllocation &gfxA
         initializeEngine();
     }
 
-    if (aubManager) {
+    if (!isChunkCopy && isDeltaUploadEnabled()) {
+        auto dirtyRanges = getDirtyRangesForUpload(gfxAllocation, gpuAddress, cpuAddress, size);
+        for (const auto &[offset, rangeSize] : dirtyRanges) {
+            if (aubManager) {
+                this->writeMemoryWithAubManager(gfxAllocation, true, offset, rangeSize);
+            } else {
+                writeMemory(gpuAddress + offset, ptrOffset(cpuAddress, offset), rangeSize, this->getMemoryBank(&gfxAllocation), this->getPPGTTAdditionalBits(&gfxAllocation));
+            }
+        }
+    } else if (aubManager) {
         this->writeMemoryWithAubManager(gfxAllocation, isChunkCopy, gpuVaChunkOffset, chunkSize);
     } else {
         if (isChunkCopy) {
@@ -529,6 +540,64 @@ bool TbxCommandStreamReceiverHw<GfxFamily>::writeMemory(GraphicsAllocation &gfxA
     return true;
 }
 
+template <typename GfxFamily>
+bool TbxCommandStreamReceiverHw<GfxFamily>::isDeltaUploadEnabled() const {
+    return debugManager.flags.EnableTbxDeltaUploads.get() == 1;
+}
+
+template <typename GfxFamily>
+std::vector<std::pair<size_t, size_t>> TbxCommandStreamReceiverHw<GfxFamily>::getDirtyRangesForUpload(GraphicsAllocation &gfxAllocation, uint64_t gpuAddress, const void *cpuAddress, size_t size) {
+    std::vector<std::pair<size_t, size_t>> dirtyRanges;
+
+    auto &state = uploadedPagesStates[&gfxAllocation];
+    const auto pageCount = Math::divideAndRoundUp(size, MemoryConstants::pageSize);
+    const bool previouslyUploaded = (state.gpuAddress == gpuAddress) && (state.size == size);
+    if (!previouslyUploaded) {
+        state.gpuAddress = gpuAddress;
+        state.size = size;
+        state.pageHashes.assign(pageCount, 0u);
+    }
+
+    for (size_t page = 0; page < pageCount; page++) {
+        const auto offset = page * MemoryConstants::pageSize;
+        const auto pageSize = std::min(MemoryConstants::pageSize, size - offset);
+        const auto pageHash = Hash::hash(reinterpret_cast<const char *>(ptrOffset(cpuAddress, offset)), pageSize);
+        if (previouslyUploaded && state.pageHashes[page] == pageHash) {
+            deltaUploadSkippedBytes += pageSize;
+            continue;
+        }
+        state.pageHashes[page] = pageHash;
+        deltaUploadWrittenBytes += pageSize;
+
+        if (!dirtyRanges.empty() && dirtyRanges.back().first + dirtyRanges.back().second == offset) {
+            dirtyRanges.back().second += pageSize;
+        } else {
+            dirtyRanges.emplace_back(offset, pageSize);
+        }
+    }
+    return dirtyRanges;
+}
+
+template <typename GfxFamily>
+void TbxCommandStreamReceiverHw<GfxFamily>::updateUploadedPagesState(GraphicsAllocation &gfxAllocation, uint64_t gpuAddress, const void *cpuAddress, size_t size) {
+    if (!isDeltaUploadEnabled() || size == 0) {
+        return;
+    }
+
+    // host memory was just read back from simulator, so its hashes describe GPU contents again
+    auto &state = uploadedPagesStates[&gfxAllocation];
+    const auto pageCount = Math::divideAndRoundUp(size, MemoryConstants::pageSize);
+    state.gpuAddress = gpuAddress;
+    state.size = size;
+    state.pageHashes.resize(pageCount);
+
+    for (size_t page = 0; page < pageCount; page++) {
+        const auto offset = page * MemoryConstants::pageSize;
+        const auto pageSize = std::min(MemoryConstants::pageSize, size - offset);
+        state.pageHashes[page] = Hash::hash(reinterpret_cast<const char *>(ptrOffset(cpuAddress, offset)), pageSize);
+    }
+}
+
 template <typename GfxFamily>
 void TbxCommandStreamReceiverHw<GfxFamily>::writeMMIO(uint32_t offset, uint32_t value) {
     if (hardwareContextController) {
@@ -608,6 +677,12 @@ SubmissionStatus TbxCommandStreamReceiverHw<GfxFamily>::processResidency(Residen
                              !this->isTbxWritable(*gfxAllocation)));
         }
         gfxAllocation->updateResidencyTaskCount(this->taskCount + 1, this->osContext->getContextId());
+        if (isDeltaUploadEnabled() && !(gfxAllocation->hasAllocationReadOnlyType() && gfxAllocation->canBeReadOnly())) {
+            // GPU may write resident allocation, host side hashes no longer describe simulator contents.
+            // Hashes are only rebuilt when the allocation is downloaded, until then it is uploaded in full.
+            // GPU read only allocations are written by host only, hashes taken on upload stay valid.
+            this->uploadedPagesStates.erase(gfxAllocation);
+        }
     }
 
     if (this->executionEnvironment.rootDeviceEnvironments[this->rootDeviceIndex]->memoryOperationsInterface) {
@@ -632,6 +707,7 @@ void TbxCommandStreamReceiverHw<GfxFamily>::downloadAllocationTbx(GraphicsAlloca
     if (hardwareContextController) {
         hardwareContextController->readMemory(gpuAddress, cpuAddress, size,
                                               this->getMemoryBank(&gfxAllocation), gfxAllocation.getUsedPageSize());
+        this->updateUploadedPagesState(gfxAllocation, gpuAddress, cpuAddress, size);
         this->protectCPUMemoryFromWritesIfTbxFaultable(&gfxAllocation, cpuAddress, size);
         return;
     }
@@ -643,6 +719,7 @@ void TbxCommandStreamReceiverHw<GfxFamily>::downloadAllocationTbx(GraphicsAlloca
         };
         ppgtt->pageWalk(static_cast<uintptr_t>(gpuAddress), size, 0, 0, walker, this->getMemoryBank(&gfxAllocation));
     }
+    this->updateUploadedPagesState(gfxAllocation, gpuAddress, cpuAddress, size);
     this->protectCPUMemoryFromWritesIfTbxFaultable(&gfxAllocation, cpuAddress, size);
 }
 
@@ -744,6 +821,7 @@ void TbxCommandStreamReceiverHw<GfxFamily>::removeDownloadAllocation(GraphicsAll
     auto lockCSR = this->obtainUniqueOwnership();
 
     this->allocationsForDownload.erase(alloc);
+    this->uploadedPagesStates.erase(alloc);
 
     auto faultManager = getTbxPageFaultManager();
     if (faultManager != nullptr) {
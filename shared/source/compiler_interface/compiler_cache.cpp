@@ -31,7 +31,8 @@ std::mutex CompilerCache::cacheAccessMtx;
 const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, const ArrayRef<const char> input,
                                                    const ArrayRef<const char> options, const ArrayRef<const char> internalOptions,
                                                    const ArrayRef<const char> specIds, const ArrayRef<const char> specValues,
-                                                   const ArrayRef<const char> igcRevision, size_t igcLibSize, time_t igcLibMTime) {
+                                                   const ArrayRef<const char> igcRevision, size_t igcLibSize, time_t igcLibMTime,
+                                                   const ArrayRef<const char> operationTag) {
     Hash hash;
 
     hash.update("----", 4);
@@ -62,6 +63,12 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
 
     hash.update(reinterpret_cast<const char *>(&hwInfo.ipVersion), sizeof(uint32_t));
 
+    // untagged entries are build outputs, other operations on the same inputs must not reuse them
+    if (!operationTag.empty()) {
+        hash.update("----", 4);
+        hash.update(&*operationTag.begin(), operationTag.size());
+    }
+
     auto res = hash.finish();
     std::stringstream stream;
     stream << std::setfill('0')
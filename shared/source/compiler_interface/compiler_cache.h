@@ -9,6 +9,7 @@
 
 #include "shared/source/os_interface/os_handle.h"
 #include "shared/source/utilities/arrayref.h"
+#include "shared/source/utilities/const_stringref.h"
 
 #include <cstdint>
 #include <memory>
@@ -35,6 +36,9 @@ class CompilerCache {
     CompilerCache(CompilerCache &&) = delete;
     CompilerCache &operator=(const CompilerCache &) = delete;
     CompilerCache &operator=(CompilerCache &&) = delete;
+
+    static constexpr ConstStringRef linkOperationTag = "link";
+
     const CompilerCacheConfig &getConfig() {
         return config;
     }
@@ -42,7 +46,8 @@ class CompilerCache {
     const std::string getCachedFileName(const HardwareInfo &hwInfo, ArrayRef<const char> input,
                                         ArrayRef<const char> options, ArrayRef<const char> internalOptions,
                                         ArrayRef<const char> specIds, ArrayRef<const char> specValues,
-                                        ArrayRef<const char> igcRevision, size_t igcLibSize, time_t igcLibMTime);
+                                        ArrayRef<const char> igcRevision, size_t igcLibSize, time_t igcLibMTime,
+                                        ArrayRef<const char> operationTag = {});
 
     MOCKABLE_VIRTUAL bool cacheBinary(const std::string &kernelFileHash, const char *pBinary, size_t binarySize);
     MOCKABLE_VIRTUAL std::unique_ptr<char[]> loadCachedBinary(const std::string &kernelFileHash, size_t &cachedBinarySize);
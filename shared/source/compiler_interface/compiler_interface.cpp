@@ -240,7 +240,23 @@ TranslationOutput::ErrorCode CompilerInterface::link(
         return TranslationOutput::ErrorCode::compilerNotAvailable;
     }
 
-    auto *igcMain = getIgc(&device)->entryPoint.get();
+    const auto &igc = *getIgc(&device);
+    const bool cachingEnabled = (cache != nullptr) && cache->getConfig().enabled;
+    std::string kernelFileHash;
+    if (cachingEnabled) {
+        kernelFileHash = cache->getCachedFileName(device.getHardwareInfo(),
+                                                  input.src,
+                                                  input.apiOptions,
+                                                  input.internalOptions, ArrayRef<const char>(), ArrayRef<const char>(), igc.revision, igc.libSize, igc.libMTime,
+                                                  ArrayRef<const char>(CompilerCache::linkOperationTag.data(), CompilerCache::linkOperationTag.size()));
+
+        bool success = CompilerCacheHelper::loadCacheAndSetOutput(*cache, kernelFileHash, output, device);
+        if (success) {
+            return TranslationOutput::ErrorCode::success;
+        }
+    }
+
+    auto *igcMain = igc.entryPoint.get();
     auto inSrc = CIF::Builtins::CreateConstBuffer(igcMain, input.src.begin(), input.src.size());
     auto igcOptions = CIF::Builtins::CreateConstBuffer(igcMain, input.apiOptions.begin(), input.apiOptions.size());
     auto igcInternalOptions = CIF::Builtins::CreateConstBuffer(igcMain, input.internalOptions.begin(), input.internalOptions.size());
@@ -279,6 +295,10 @@ TranslationOutput::ErrorCode CompilerInterface::link(
     TranslationOutput::makeCopy(output.deviceBinary, currOut->GetOutput());
     TranslationOutput::makeCopy(output.debugData, currOut->GetDebugData());
 
+    if (cachingEnabled) {
+        CompilerCacheHelper::packAndCacheBinary(*cache, kernelFileHash, NEO::getTargetDevice(device.getRootDeviceEnvironment()), output);
+    }
+
     return TranslationOutput::ErrorCode::success;
 }
 
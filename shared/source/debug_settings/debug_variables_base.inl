@@ -25,6 +25,8 @@ DECLARE_DEBUG_VARIABLE(int32_t, AUBDumpSubCaptureMode, 0, "AUB dump subcapture m
 DECLARE_DEBUG_VARIABLE(int32_t, AUBDumpFilterKernelStartIdx, 0, "Start index of kernel to AUB capture")
 DECLARE_DEBUG_VARIABLE(int32_t, AUBDumpFilterKernelEndIdx, -1, "End index of kernel to AUB capture")
 DECLARE_DEBUG_VARIABLE(int32_t, AUBDumpToggleCaptureOnOff, 0, "Toggle AUB capture on/off")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableAsyncAubFileWriter, -1, "-1: default (disabled), 0: disabled, 1: AUB file records are buffered in memory and written to file by a background thread")
+DECLARE_DEBUG_VARIABLE(int32_t, AsyncAubFileWriterMaxPendingBytes, -1, "-1: default (64MB), >0: maximum number of bytes buffered by async AUB file writer before capture waits for the writer thread")
 DECLARE_DEBUG_VARIABLE(int32_t, AubDumpOverrideMmioRegister, 0, "Override mmio offset from list with new value from AubDumpOverrideMmioRegisterValue")
 DECLARE_DEBUG_VARIABLE(int32_t, AubDumpOverrideMmioRegisterValue, 0, "Value to override mmio offset from AubDumpOverrideMmioRegister")
 DECLARE_DEBUG_VARIABLE(int32_t, ClDeviceGlobalMemSizeAvailablePercent, -1, "Percent of total GPU memory available; CL_DEVICE_GLOBAL_MEM_SIZE")
@@ -42,6 +44,8 @@ DECLARE_DEBUG_VARIABLE(bool, AUBDumpForceAllToLocalMemory, false, "Force placing
 DECLARE_DEBUG_VARIABLE(bool, GenerateAubFilePerProcessId, true, "Generate aub file with process id")
 DECLARE_DEBUG_VARIABLE(bool, SetBufferHostMemoryAlwaysAubWritable, false, "Make buffer host memory allocation always uploaded to AUB/TBX")
 DECLARE_DEBUG_VARIABLE(bool, EnableTbxPageFaultManager, false, "Enables experiemental page fault manager for host buffer types, improves upon SetBufferHostMemoryAlwaysAubWritable")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableTbxSocketWriteBatching, -1, "-1: default (disabled), 0: disabled, 1: TBX socket write requests are queued, adjacent memory writes are merged and the queue is sent before any read request")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableTbxDeltaUploads, -1, "-1: default (disabled), 0: disabled, 1: TBX CSR tracks content hash of each 4KB page of written allocations and re-sends only pages whose host content changed since the last upload")
 
 /*DEBUG FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, EnableSWTags, false, "Enable software tagging in batch buffer")
@@ -168,6 +172,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, FormatForStatelessCompressionWithUnifiedMemory,
 DECLARE_DEBUG_VARIABLE(int32_t, ForceBufferCompressionFormat, -1, "-1: default, >0: Format value")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableHwGenerationLocalIds, -1, "-1: default, 0: disable, 1: enable : Enables generation of local ids on HW")
 DECLARE_DEBUG_VARIABLE(int32_t, WalkerPartitionPreferHighestDimension, -1, "-1: default, 0: prefer biggest dimension, 1: prefer Z over Y over X if they divide partition count evenly")
+DECLARE_DEBUG_VARIABLE(int32_t, WalkerPartitionSelectDimensionByImbalance, -1, "-1: default (disabled), 0: disabled, 1: select partition dimension with the lowest fraction of idle workgroup slots across partitions, deeper dimension wins ties")
 DECLARE_DEBUG_VARIABLE(int32_t, SetMinimalPartitionSize, -1, "-1 default value set to 512 workgroups, 0 - disabled, >0 - minimal partition size in workgroups (should be power of 2)")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideBlitterTargetMemory, -1, "-1:default 0: overwrites to System 1: overwrites to Local")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideBlitterMocs, -1, "-1: default, >=0 Override MOCS value")
@@ -331,6 +336,7 @@ DECLARE_DEBUG_VARIABLE(bool, LogAllocationType, false, "Logs allocation type to
 DECLARE_DEBUG_VARIABLE(bool, LogAllocationStdout, false, "Log allocations to stdout instead of file")
 DECLARE_DEBUG_VARIABLE(bool, LogMemoryObject, false, "Logs memory object ptrs, sizes and operations")
 DECLARE_DEBUG_VARIABLE(bool, LogWaitingForCompletion, false, "Logs waiting for completion")
+DECLARE_DEBUG_VARIABLE(int32_t, LogFileBufferSize, -1, "-1: default (disabled), >0: size in bytes of in-memory buffer collecting log file messages. Buffer is written to file with a single write when full, when an API call returns an error, on abort and when logger is destroyed")
 DECLARE_DEBUG_VARIABLE(bool, ResidencyDebugEnable, false, "enables debug messages and checks for Residency Model")
 DECLARE_DEBUG_VARIABLE(bool, EventsDebugEnable, false, "enables debug messages for events, virtual events, blocked enqueues, events trees etc.")
 DECLARE_DEBUG_VARIABLE(bool, EventsTrackerEnable, false, "enables event graphs dumping")
@@ -422,6 +428,12 @@ DECLARE_DEBUG_VARIABLE(int32_t, ForcePostSyncL1Flush, -1, "-1: default (do nothi
 DECLARE_DEBUG_VARIABLE(int32_t, AllowNotZeroForCompressedOnWddm, -1, "-1: default (do nothing), 0: do not set AllowNotZeroed for compressed resources, 1: set AllowNotZeroed for compressed resources");
 DECLARE_DEBUG_VARIABLE(int32_t, ForceWddmHugeChunkSizeMB, -1, "-1: default (do nothing), >0: set given huge chunk size in MegaBytes for WDDM");
 DECLARE_DEBUG_VARIABLE(int64_t, ForceGmmSystemMemoryBufferForAllocations, 0, "0: default, >0: (bitmask) for given Allocation Types, force GMM_RESOURCE_USAGE_OCL_SYSTEM_MEMORY_BUFFER gmm resource type");
+DECLARE_DEBUG_VARIABLE(int32_t, SysmanPmuSampleCacheWindowUs, -1, "-1: default (disabled), 0: disabled, >0: PMU counter samples read by sysman are reused by queries issued within given window in microseconds")
+DECLARE_DEBUG_VARIABLE(int32_t, MetricStreamerBackgroundReadReportCount, -1, "-1: default (disabled), 0: disabled, >0: metric streamer drains oa buffer in background thread into ring of given capacity in reports")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableDispatchWalkerTemplate, -1, "-1: default (disabled), 0: disabled, 1: enabled. Walker fields that do not change between launches are programmed once per kernel and reused on later dispatches")
+DECLARE_DEBUG_VARIABLE(int32_t, ImmediateCmdListCoalesceFlushCount, -1, "-1: default (disabled), 0, 1: disabled, >1: max number of appends without signal event that immediate command list accumulates into a single submission. Pending work is submitted on host synchronization, memory free and command list destruction")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalCopyThroughLockStreamingStores, -1, "-1: default (enabled), 0: disabled, 1: enabled. CPU copy to locked device memory uses non-temporal stores")
+DECLARE_DEBUG_VARIABLE(int32_t, SkipSatisfiedInOrderWaits, -1, "-1: default (disabled), 0: disabled, 1: enabled. Immediate command list does not program in-order semaphore wait if host visible counter already reached the wait value")
 
 /*DIRECT SUBMISSION FLAGS*/
 DECLARE_DEBUG_VARIABLE(int32_t, EnableDirectSubmission, -1, "-1: default (disabled), 0: disable, 1:enable. Enables direct submission of command buffers bypassing KMD")
@@ -466,6 +478,8 @@ DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionSwitchSemaphoreMode, -1, "-1: de
 DECLARE_DEBUG_VARIABLE(bool, DirectSubmissionPrintBuffers, false, "Print address of submitted command buffers")
 DECLARE_DEBUG_VARIABLE(int32_t, WaitForPagingFenceInController, -1, "Instead of waiting for paging fence on user thread, program additional semaphore which will be signaled by direct submission controller when paging fence reaches required value -1: default, 0 - disable, 1 - enable.")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionControllerIdleDetection, -1, "Terminate direct submission only if CSR is idle. -1: default, 0 - disable, 1 - enable.")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionPrintLatencyStats, -1, "-1: default (disabled), 0: disabled, 1: enabled. Collect per phase submission latency counters and histograms and print them when direct submission is destroyed")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionControllerIdlePredictionRestartCost, -1, "-1: default (disabled), 0: disabled, >0: cost of restarting a stopped ring expressed in microseconds of ring polling. Controller records idle gaps per engine and keeps the ring running while expected remaining idle time is below that cost")
 /*FEATURE FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, USMEvictAfterMigration, false, "Evict USM allocation after implicit migration to GPU")
 DECLARE_DEBUG_VARIABLE(bool, RegisterPageFaultHandlerOnMigration, false, "Register handler on migration to GPU when current is not from pagefault manager")
@@ -561,6 +575,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, SignalAllEventPackets, -1, "All packets of event
 DECLARE_DEBUG_VARIABLE(int32_t, EnableBcsSwControlWa, -1, "Enable BCS WA via BCSSWCONTROL MMIO. -1: default, 0: disabled, 1: if src in system mem, 2: if dst in system mem, 3: if src and dst in system mem, 4: always")
 DECLARE_DEBUG_VARIABLE(bool, EnableHostAllocationMemPolicy, false, "Enables Memory Policy for host allocation")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideHostAllocationMemPolicyMode, -1, "Override Memory Policy mode for host allocation -1: default (use the system configuration), 0: MPOL_DEFAULT, 1: MPOL_PREFERRED, 2: MPOL_BIND, 3: MPOL_INTERLEAVED, 4: MPOL_LOCAL, 5: MPOL_PREFERRED_MANY")
+DECLARE_DEBUG_VARIABLE(int32_t, OverrideHostAllocationMemPolicyNode, -1, "Override NUMA node used for host allocation when memory policy is enabled -1: default (use the NUMA node local to the device when known, otherwise the system configuration), >=0: NUMA node id")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableFtrTile64Optimization, 0, "Control feature Tile64 Optimization flag passed to gmmlib. -1: pass as-is, 0: disable flag(default due to NEO-10623), 1: enable flag");
 DECLARE_DEBUG_VARIABLE(int32_t, ForceTheMaximumNumberOfOutstandingRayqueriesPerSs, -1, "Set the maximum number of outstanding RayQueries per SS, -1: default, 0: 128, 1: 256, 2: 512, 3: 1024")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceDispatchTimeoutCounter, -1, "Set timeout for Synchronous Ray Tracing, -1: default, 0: 64, 1: 128, 2: 192, 3: 256, 4: 512, 5: 1024, 6: 2048, 7: 4096")
@@ -10,6 +10,7 @@
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/execution_environment/root_device_environment.h"
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/sleep.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/os_thread.h"
@@ -39,6 +40,9 @@ DirectSubmissionController::DirectSubmissionController() {
     if (debugManager.flags.DirectSubmissionControllerIdleDetection.get() != -1) {
         isCsrIdleDetectionEnabled = debugManager.flags.DirectSubmissionControllerIdleDetection.get();
     }
+    if (debugManager.flags.DirectSubmissionControllerIdlePredictionRestartCost.get() > 0) {
+        idlePredictionRestartCost = std::chrono::microseconds{debugManager.flags.DirectSubmissionControllerIdlePredictionRestartCost.get()};
+    }
 };
 
 DirectSubmissionController::~DirectSubmissionController() {
@@ -47,8 +51,10 @@ DirectSubmissionController::~DirectSubmissionController() {
 
 void DirectSubmissionController::registerDirectSubmission(CommandStreamReceiver *csr) {
     std::lock_guard<std::mutex> lock(directSubmissionsMutex);
-    directSubmissions.insert(std::make_pair(csr, DirectSubmissionState()));
+    auto &state = directSubmissions.insert(std::make_pair(csr, DirectSubmissionState())).first->second;
     this->adjustTimeout(csr);
+    // idle gaps are only observed once per controller check, finer buckets could never be filled
+    state.idlePredictor.setFirstBucketLimit(this->timeout);
 }
 
 void DirectSubmissionController::setTimeoutParamsForPlatform(const ProductHelper &helper) {
@@ -163,6 +169,17 @@ void DirectSubmissionController::checkNewSubmissions() {
             if (state.isStopped) {
                 continue;
             }
+            if (this->idlePredictionRestartCost.count() > 0) {
+                const auto now = getCpuTimestamp();
+                if (!state.idleObserved) {
+                    state.idleObserved = true;
+                    state.idleSince = now;
+                }
+                const auto idleTime = std::chrono::duration_cast<std::chrono::microseconds>(now - state.idleSince);
+                if (!state.idlePredictor.isStopPreferred(idleTime, this->idlePredictionRestartCost)) {
+                    continue;
+                }
+            }
             auto lock = csr->obtainUniqueOwnership();
             if (!isCsrIdleDetectionEnabled || isDirectSubmissionIdle(csr, lock)) {
                 csr->stopDirectSubmission(false);
@@ -172,6 +189,10 @@ void DirectSubmissionController::checkNewSubmissions() {
             }
             state.taskCount = csr->peekTaskCount();
         } else {
+            if (state.idleObserved) {
+                state.idlePredictor.recordGap(std::chrono::duration_cast<std::chrono::microseconds>(getCpuTimestamp() - state.idleSince));
+                state.idleObserved = false;
+            }
             state.isStopped = false;
             state.taskCount = taskCount;
             if (this->adjustTimeoutOnThrottleAndAcLineStatus) {
@@ -276,6 +297,68 @@ void DirectSubmissionController::handlePagingFenceRequests(std::unique_lock<std:
     }
 }
 
+uint32_t DirectSubmissionIdlePredictor::getBucketIndex(std::chrono::microseconds gap) const {
+    if (gap.count() <= 0) {
+        return 0u;
+    }
+    const auto units = static_cast<uint64_t>(gap.count() / firstBucketLimit.count());
+    if (units == 0u) {
+        return 0u;
+    }
+    return std::min(Math::log2(units) + 1u, bucketsCount - 1u);
+}
+
+std::chrono::microseconds DirectSubmissionIdlePredictor::getBucketValue(uint32_t bucketIndex) const {
+    if (bucketIndex == 0u) {
+        return firstBucketLimit / 2;
+    }
+    // midpoint of [limit * 2^(i-1), limit * 2^i)
+    return std::chrono::microseconds{(firstBucketLimit.count() * 3 / 2) << (bucketIndex - 1u)};
+}
+
+void DirectSubmissionIdlePredictor::setFirstBucketLimit(std::chrono::microseconds limit) {
+    firstBucketLimit = std::max(limit, std::chrono::microseconds{1});
+    buckets.fill(0u);
+    samplesCount = 0u;
+}
+
+void DirectSubmissionIdlePredictor::recordGap(std::chrono::microseconds gap) {
+    buckets[getBucketIndex(gap)]++;
+    samplesCount++;
+
+    if (samplesCount >= decaySamplesCount) {
+        // age out old history so prediction follows changes in submission pattern
+        samplesCount = 0u;
+        for (auto &bucket : buckets) {
+            bucket /= 2;
+            samplesCount += bucket;
+        }
+    }
+}
+
+bool DirectSubmissionIdlePredictor::isStopPreferred(std::chrono::microseconds idleTime, std::chrono::microseconds restartCost) const {
+    if (samplesCount < minSamplesCount) {
+        return true;
+    }
+
+    // Keeping the ring running costs polling for the remaining idle time, stopping costs one restart.
+    // Compare restart cost with expected remaining idle time among gaps longer than already observed.
+    uint64_t weight = 0u;
+    uint64_t remainingIdleTime = 0u;
+    for (uint32_t bucketIndex = 0u; bucketIndex < bucketsCount; bucketIndex++) {
+        const auto bucketValue = getBucketValue(bucketIndex);
+        if (buckets[bucketIndex] == 0u || bucketValue <= idleTime) {
+            continue;
+        }
+        weight += buckets[bucketIndex];
+        remainingIdleTime += buckets[bucketIndex] * static_cast<uint64_t>((bucketValue - idleTime).count());
+    }
+    if (weight == 0u) {
+        return true;
+    }
+    return remainingIdleTime >= weight * static_cast<uint64_t>(restartCost.count());
+}
+
 TimeoutElapsedMode DirectSubmissionController::timeoutElapsed() {
     auto diff = std::chrono::duration_cast<std::chrono::microseconds>(getCpuTimestamp() - this->timeSinceLastCheck);
     if (diff >= this->timeout) {
@@ -41,6 +41,27 @@ struct WaitForPagingFenceRequest {
     uint64_t pagingFenceValue;
 };
 
+class DirectSubmissionIdlePredictor {
+  public:
+    static constexpr uint32_t bucketsCount = 16u;
+    static constexpr uint32_t minSamplesCount = 4u;
+    static constexpr uint32_t decaySamplesCount = 64u;
+
+    void recordGap(std::chrono::microseconds gap);
+    bool isStopPreferred(std::chrono::microseconds idleTime, std::chrono::microseconds restartCost) const;
+    uint32_t getSamplesCount() const { return samplesCount; }
+    void setFirstBucketLimit(std::chrono::microseconds limit);
+    std::chrono::microseconds getFirstBucketLimit() const { return firstBucketLimit; }
+
+    uint32_t getBucketIndex(std::chrono::microseconds gap) const;
+    std::chrono::microseconds getBucketValue(uint32_t bucketIndex) const;
+
+  protected:
+    std::array<uint32_t, bucketsCount> buckets = {};
+    std::chrono::microseconds firstBucketLimit{64};
+    uint32_t samplesCount = 0u;
+};
+
 enum class TimeoutElapsedMode {
     notElapsed,
     bcsOnly,
@@ -72,6 +93,9 @@ class DirectSubmissionController {
         DirectSubmissionState(DirectSubmissionState &&other) {
             isStopped = other.isStopped.load();
             taskCount = other.taskCount.load();
+            idleSince = other.idleSince;
+            idleObserved = other.idleObserved;
+            idlePredictor = other.idlePredictor;
         }
         DirectSubmissionState &operator=(const DirectSubmissionState &other) {
             if (this == &other) {
@@ -79,6 +103,9 @@ class DirectSubmissionController {
             }
             this->isStopped = other.isStopped.load();
             this->taskCount = other.taskCount.load();
+            this->idleSince = other.idleSince;
+            this->idleObserved = other.idleObserved;
+            this->idlePredictor = other.idlePredictor;
             return *this;
         }
 
@@ -90,6 +117,9 @@ class DirectSubmissionController {
 
         std::atomic_bool isStopped{true};
         std::atomic<TaskCountType> taskCount{0};
+        SteadyClock::time_point idleSince{};
+        bool idleObserved = false;
+        DirectSubmissionIdlePredictor idlePredictor;
     };
 
     static void *controlDirectSubmissionsState(void *self);
@@ -122,6 +152,7 @@ class DirectSubmissionController {
     HighResolutionClock::time_point lastHangCheckTime{};
     std::chrono::microseconds maxTimeout{defaultTimeout};
     std::chrono::microseconds timeout{defaultTimeout};
+    std::chrono::microseconds idlePredictionRestartCost{0};
     int32_t timeoutDivisor = 1;
     int32_t bcsTimeoutDivisor = 1;
     std::unordered_map<size_t, TimeoutParams> timeoutParamsMap;
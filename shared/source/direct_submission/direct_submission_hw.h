@@ -56,6 +56,7 @@ inline constexpr bool defaultDisableMonitorFence = true;
 
 struct BatchBuffer;
 class DirectSubmissionDiagnosticsCollector;
+class DirectSubmissionLatencyStats;
 class FlushStampTracker;
 class GraphicsAllocation;
 struct HardwareInfo;
@@ -193,6 +194,10 @@ class DirectSubmissionHw {
 
     void updateRelaxedOrderingQueueSize(uint32_t newSize);
 
+    const DirectSubmissionLatencyStats *getLatencyStats() const {
+        return latencyStats.get();
+    }
+
     virtual void makeGlobalFenceAlwaysResident(){};
     struct RingBufferUse {
         RingBufferUse() = default;
@@ -212,6 +217,7 @@ class DirectSubmissionHw {
 
     LinearStream ringCommandStream;
     std::unique_ptr<DirectSubmissionDiagnosticsCollector> diagnostic;
+    std::unique_ptr<DirectSubmissionLatencyStats> latencyStats;
 
     uint64_t semaphoreGpuVa = 0u;
     uint64_t gpuVaForMiFlush = 0u;
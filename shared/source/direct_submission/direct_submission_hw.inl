@@ -12,6 +12,7 @@
 #include "shared/source/device/device.h"
 #include "shared/source/direct_submission/direct_submission_hw.h"
 #include "shared/source/direct_submission/direct_submission_hw_diagnostic_mode.h"
+#include "shared/source/direct_submission/direct_submission_latency_stats.h"
 #include "shared/source/direct_submission/relaxed_ordering_helper.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
@@ -20,6 +21,7 @@
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/compiler_product_helper.h"
 #include "shared/source/helpers/definitions/command_encoder_args.h"
+#include "shared/source/helpers/engine_node_helper.h"
 #include "shared/source/helpers/flush_stamp.h"
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/hw_info.h"
@@ -103,6 +105,10 @@ DirectSubmissionHw<GfxFamily, Dispatcher>::DirectSubmissionHw(const DirectSubmis
 
     UNRECOVERABLE_IF(!CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureClflush) && !disableCpuCacheFlush);
 
+    if (debugManager.flags.DirectSubmissionPrintLatencyStats.get() == 1) {
+        latencyStats = std::make_unique<DirectSubmissionLatencyStats>();
+    }
+
     createDiagnostic();
     setImmWritePostSyncOffset();
 
@@ -323,7 +329,11 @@ void DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchRelaxedOrderingScheduler
 }
 
 template <typename GfxFamily, typename Dispatcher>
-DirectSubmissionHw<GfxFamily, Dispatcher>::~DirectSubmissionHw() = default;
+DirectSubmissionHw<GfxFamily, Dispatcher>::~DirectSubmissionHw() {
+    if (latencyStats) {
+        printf("%s", latencyStats->toString(EngineHelpers::engineTypeToString(osContext.getEngineType())).c_str());
+    }
+}
 
 template <typename GfxFamily, typename Dispatcher>
 bool DirectSubmissionHw<GfxFamily, Dispatcher>::allocateResources() {
@@ -427,6 +437,8 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::makeResourcesResident(DirectSubm
 
 template <typename GfxFamily, typename Dispatcher>
 inline void DirectSubmissionHw<GfxFamily, Dispatcher>::unblockGpu() {
+    DirectSubmissionLatencyScope latencyScope(latencyStats.get(), DirectSubmissionPhase::unblockGpu);
+
     if (sfenceMode >= DirectSubmissionSfenceMode::beforeSemaphoreOnly) {
         CpuIntrinsics::sfence();
     }
@@ -451,6 +463,8 @@ inline void DirectSubmissionHw<GfxFamily, Dispatcher>::cpuCachelineFlush(void *p
     if (disableCpuCacheFlush) {
         return;
     }
+    DirectSubmissionLatencyScope latencyScope(latencyStats.get(), DirectSubmissionPhase::cpuCachelineFlush);
+
     constexpr size_t cachlineBit = 6;
     static_assert(MemoryConstants::cacheLineSize == 1 << cachlineBit, "cachlineBit has invalid value");
     char *flushPtr = reinterpret_cast<char *>(ptr);
@@ -728,6 +742,7 @@ void *DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchWorkloadSection(BatchBu
             auto cmdStreamTaskPtr = ptrOffset(batchBuffer.stream->getCpuBase(), batchBuffer.startOffset);
             auto sizeToCopy = ptrDiff(returnCmd, cmdStreamTaskPtr);
             auto ringPtr = ringCommandStream.getSpace(sizeToCopy);
+            DirectSubmissionLatencyScope latencyScope(latencyStats.get(), DirectSubmissionPhase::copyCommandBufferIntoRing);
             memcpy(ringPtr, cmdStreamTaskPtr, sizeToCopy);
         } else {
             dispatchStartSection(commandStreamAddress);
@@ -964,6 +979,8 @@ void DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchUllsState() {
 
 template <typename GfxFamily, typename Dispatcher>
 bool DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchCommandBuffer(BatchBuffer &batchBuffer, FlushStampTracker &flushStamp) {
+    DirectSubmissionLatencyScope latencyScope(latencyStats.get(), DirectSubmissionPhase::dispatchCommandBuffer);
+
     lastSubmittedThrottle = batchBuffer.throttle;
     bool relaxedOrderingSchedulerWillBeNeeded = (this->relaxedOrderingSchedulerRequired || batchBuffer.hasRelaxedOrderingDependencies);
     bool inputRequiredMonitorFence = false;
@@ -1041,6 +1058,7 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::submitCommandBufferToGpu(bool ne
         return this->ringStart;
     } else {
         if (needWait) {
+            DirectSubmissionLatencyScope latencyScope(latencyStats.get(), DirectSubmissionPhase::handleResidency);
             handleResidency();
         }
         this->unblockGpu();
@@ -1089,6 +1107,7 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::isNewResourceHandleNeeded() {
 template <typename GfxFamily, typename Dispatcher>
 void DirectSubmissionHw<GfxFamily, Dispatcher>::switchRingBuffersNeeded(size_t size, ResidencyContainer *allocationsForResidency) {
     if (this->ringCommandStream.getAvailableSpace() < size) {
+        DirectSubmissionLatencyScope latencyScope(latencyStats.get(), DirectSubmissionPhase::switchRingBuffers);
         this->switchRingBuffers(allocationsForResidency);
     }
 }
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/direct_submission/direct_submission_latency_stats.h"
+
+#include <algorithm>
+#include <sstream>
+
+namespace NEO {
+
+void DirectSubmissionPhaseStats::record(uint64_t ticks) {
+    samples++;
+    totalTicks += ticks;
+    maxTicks = std::max(maxTicks, ticks);
+
+    uint32_t bucket = 0u;
+    while ((ticks >>= 1) != 0u && bucket < histogramBuckets - 1) {
+        bucket++;
+    }
+    histogram[bucket]++;
+}
+
+const char *DirectSubmissionLatencyStats::getPhaseName(DirectSubmissionPhase phase) {
+    switch (phase) {
+    case DirectSubmissionPhase::dispatchCommandBuffer:
+        return "dispatchCommandBuffer";
+    case DirectSubmissionPhase::copyCommandBufferIntoRing:
+        return "copyCommandBufferIntoRing";
+    case DirectSubmissionPhase::switchRingBuffers:
+        return "switchRingBuffers";
+    case DirectSubmissionPhase::unblockGpu:
+        return "unblockGpu";
+    case DirectSubmissionPhase::cpuCachelineFlush:
+        return "cpuCachelineFlush";
+    case DirectSubmissionPhase::handleResidency:
+        return "handleResidency";
+    default:
+        return "unknown";
+    }
+}
+
+std::string DirectSubmissionLatencyStats::toString(const std::string &engineName) const {
+    std::stringstream stream;
+    stream << "Direct submission latency stats for engine " << engineName << " (timestamp counter ticks)\n";
+
+    for (uint32_t i = 0; i < static_cast<uint32_t>(DirectSubmissionPhase::count); i++) {
+        auto &phaseStats = phases[i];
+        if (phaseStats.samples == 0u) {
+            continue;
+        }
+
+        stream << getPhaseName(static_cast<DirectSubmissionPhase>(i))
+               << ": samples " << phaseStats.samples
+               << ", avg " << (phaseStats.totalTicks / phaseStats.samples)
+               << ", max " << phaseStats.maxTicks
+               << ", histogram";
+        for (uint32_t bucket = 0; bucket < DirectSubmissionPhaseStats::histogramBuckets; bucket++) {
+            if (phaseStats.histogram[bucket] != 0u) {
+                stream << " [" << (1ull << bucket) << "]=" << phaseStats.histogram[bucket];
+            }
+        }
+        stream << "\n";
+    }
+
+    return stream.str();
+}
+
+} // namespace NEO
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/utilities/cpuintrinsics.h"
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace NEO {
+
+enum class DirectSubmissionPhase : uint32_t {
+    dispatchCommandBuffer = 0,
+    copyCommandBufferIntoRing,
+    switchRingBuffers,
+    unblockGpu,
+    cpuCachelineFlush,
+    handleResidency,
+    count
+};
+
+struct DirectSubmissionPhaseStats {
+    // Bucket i counts samples with duration in [2^i, 2^(i+1)) timestamp counter ticks, bucket 0 also counts zero
+    static constexpr uint32_t histogramBuckets = 32u;
+
+    void record(uint64_t ticks);
+
+    uint64_t samples = 0u;
+    uint64_t totalTicks = 0u;
+    uint64_t maxTicks = 0u;
+    std::array<uint64_t, histogramBuckets> histogram = {};
+};
+
+class DirectSubmissionLatencyStats : NonCopyableOrMovableClass {
+  public:
+    void record(DirectSubmissionPhase phase, uint64_t ticks) {
+        phases[static_cast<uint32_t>(phase)].record(ticks);
+    }
+
+    const DirectSubmissionPhaseStats &getPhaseStats(DirectSubmissionPhase phase) const {
+        return phases[static_cast<uint32_t>(phase)];
+    }
+
+    static const char *getPhaseName(DirectSubmissionPhase phase);
+    std::string toString(const std::string &engineName) const;
+
+  protected:
+    std::array<DirectSubmissionPhaseStats, static_cast<uint32_t>(DirectSubmissionPhase::count)> phases = {};
+};
+
+class DirectSubmissionLatencyScope : NonCopyableOrMovableClass {
+  public:
+    DirectSubmissionLatencyScope(DirectSubmissionLatencyStats *stats, DirectSubmissionPhase phase) : stats(stats), phase(phase) {
+        if (stats) {
+            startTicks = CpuIntrinsics::rdtsc();
+        }
+    }
+
+    ~DirectSubmissionLatencyScope() {
+        if (stats) {
+            stats->record(phase, CpuIntrinsics::rdtsc() - startTicks);
+        }
+    }
+
+  protected:
+    DirectSubmissionLatencyStats *stats;
+    DirectSubmissionPhase phase;
+    uint64_t startTicks = 0u;
+};
+
+} // namespace NEO
@@ -170,8 +170,6 @@ bool BindlessHeapsHelper::isReservedMemoryModeAvailable() {
 }
 
 void BindlessHeapsHelper::clearStateDirtyForContext(uint32_t osContextId) {
-    std::lock_guard<std::mutex> autolock(this->mtx);
-
     uint32_t contextIdShifted = osContextId - memManager->getFirstContextIdForRootDevice(rootDeviceIndex);
     DEBUG_BREAK_IF(contextIdShifted >= stateCacheDirtyForContext.size());
 
@@ -179,8 +177,7 @@ void BindlessHeapsHelper::clearStateDirtyForContext(uint32_t osContextId) {
 }
 
 bool BindlessHeapsHelper::getStateDirtyForContext(uint32_t osContextId) {
-    std::lock_guard<std::mutex> autolock(this->mtx);
-
+    // queried on every submission, dirty mask is atomic so it does not contend with slot allocation
     uint32_t contextIdShifted = osContextId - memManager->getFirstContextIdForRootDevice(rootDeviceIndex);
     DEBUG_BREAK_IF(contextIdShifted >= stateCacheDirtyForContext.size());
 
@@ -190,40 +187,20 @@ bool BindlessHeapsHelper::getStateDirtyForContext(uint32_t osContextId) {
 SurfaceStateInHeapInfo BindlessHeapsHelper::allocateSSInHeap(size_t ssSize, GraphicsAllocation *surfaceAllocation, BindlesHeapType heapType) {
     auto heap = surfaceStateHeaps[heapType].get();
 
-    std::lock_guard<std::mutex> autolock(this->mtx);
+    // slot allocation and release are serialized, only the dirty state queries are lock free
+    std::unique_lock<std::mutex> autolock(this->mtx);
     if (heapType == BindlesHeapType::globalSsh) {
 
         if (!allocateFromReusePool) {
             if ((surfaceStateInHeapVectorReuse[releasePoolIndex][0].size() + surfaceStateInHeapVectorReuse[releasePoolIndex][1].size()) > reuseSlotCountThreshold) {
-
-                // invalidate all contexts
-                stateCacheDirtyForContext.set();
-                allocateFromReusePool = true;
-                allocatePoolIndex = releasePoolIndex;
-                releasePoolIndex = allocatePoolIndex == 0 ? 1 : 0;
+                switchReusePools();
             }
         }
 
         if (allocateFromReusePool) {
-            int index = getReusedSshVectorIndex(ssSize);
-
-            if (surfaceStateInHeapVectorReuse[allocatePoolIndex][index].size()) {
-                SurfaceStateInHeapInfo surfaceStateFromVector = surfaceStateInHeapVectorReuse[allocatePoolIndex][index].back();
-                surfaceStateInHeapVectorReuse[allocatePoolIndex][index].pop_back();
-
-                if (surfaceStateInHeapVectorReuse[allocatePoolIndex][index].empty()) {
-                    allocateFromReusePool = false;
-
-                    // copy remaining slots from allocate pool to release pool
-                    int otherSizeIndex = index == 0 ? 1 : 0;
-                    surfaceStateInHeapVectorReuse[releasePoolIndex][otherSizeIndex].insert(surfaceStateInHeapVectorReuse[releasePoolIndex][otherSizeIndex].end(),
-                                                                                           surfaceStateInHeapVectorReuse[allocatePoolIndex][otherSizeIndex].begin(),
-                                                                                           surfaceStateInHeapVectorReuse[allocatePoolIndex][otherSizeIndex].end());
-
-                    surfaceStateInHeapVectorReuse[allocatePoolIndex][otherSizeIndex].clear();
-                }
-
-                return surfaceStateFromVector;
+            auto surfaceStateFromVector = allocateFromReusePoolVector(ssSize);
+            if (surfaceStateFromVector.has_value()) {
+                return surfaceStateFromVector.value();
             }
         }
     }
@@ -232,15 +209,67 @@ SurfaceStateInHeapInfo BindlessHeapsHelper::allocateSSInHeap(size_t ssSize, Grap
     SurfaceStateInHeapInfo bindlesInfo = {nullptr, 0, nullptr};
 
     if (ptrInHeap) {
-        memset(ptrInHeap, 0, ssSize);
         auto bindlessOffset = heap->getGraphicsAllocation()->getGpuAddress() - heap->getGraphicsAllocation()->getGpuBaseAddress() + heap->getUsed() - ssSize;
 
         bindlesInfo = SurfaceStateInHeapInfo{heap->getGraphicsAllocation(), bindlessOffset, ptrInHeap, ssSize};
+
+        // slot is owned by the caller now, clear it outside of the lock
+        autolock.unlock();
+        memset(ptrInHeap, 0, ssSize);
+    } else if (heapType == BindlesHeapType::globalSsh) {
+        int index = getReusedSshVectorIndex(ssSize);
+
+        if (surfaceStateInHeapVectorReuse[releasePoolIndex][index].size()) {
+            // heap cannot grow anymore, recycle released slots below reuse threshold instead of failing
+            if (allocateFromReusePool) {
+                for (int sizeIndex = 0; sizeIndex < 2; sizeIndex++) {
+                    surfaceStateInHeapVectorReuse[releasePoolIndex][sizeIndex].insert(surfaceStateInHeapVectorReuse[releasePoolIndex][sizeIndex].end(),
+                                                                                      surfaceStateInHeapVectorReuse[allocatePoolIndex][sizeIndex].begin(),
+                                                                                      surfaceStateInHeapVectorReuse[allocatePoolIndex][sizeIndex].end());
+                    surfaceStateInHeapVectorReuse[allocatePoolIndex][sizeIndex].clear();
+                }
+            }
+            switchReusePools();
+            bindlesInfo = allocateFromReusePoolVector(ssSize).value();
+        }
     }
 
     return bindlesInfo;
 }
 
+void BindlessHeapsHelper::switchReusePools() {
+    // invalidate all contexts
+    stateCacheDirtyForContext.set();
+    allocateFromReusePool = true;
+    allocatePoolIndex = releasePoolIndex;
+    releasePoolIndex = allocatePoolIndex == 0 ? 1 : 0;
+}
+
+std::optional<SurfaceStateInHeapInfo> BindlessHeapsHelper::allocateFromReusePoolVector(size_t ssSize) {
+    int index = getReusedSshVectorIndex(ssSize);
+
+    if (surfaceStateInHeapVectorReuse[allocatePoolIndex][index].empty()) {
+        return std::nullopt;
+    }
+
+    SurfaceStateInHeapInfo surfaceStateFromVector = surfaceStateInHeapVectorReuse[allocatePoolIndex][index].back();
+    surfaceStateInHeapVectorReuse[allocatePoolIndex][index].pop_back();
+
+    if (surfaceStateInHeapVectorReuse[allocatePoolIndex][index].empty()) {
+        allocateFromReusePool = false;
+
+        // copy remaining slots from allocate pool to release pool
+        int otherSizeIndex = index == 0 ? 1 : 0;
+        surfaceStateInHeapVectorReuse[releasePoolIndex][otherSizeIndex].insert(surfaceStateInHeapVectorReuse[releasePoolIndex][otherSizeIndex].end(),
+                                                                               surfaceStateInHeapVectorReuse[allocatePoolIndex][otherSizeIndex].begin(),
+                                                                               surfaceStateInHeapVectorReuse[allocatePoolIndex][otherSizeIndex].end());
+
+        surfaceStateInHeapVectorReuse[allocatePoolIndex][otherSizeIndex].clear();
+    }
+
+    return surfaceStateFromVector;
+}
+
 void *BindlessHeapsHelper::getSpaceInHeap(size_t ssSize, BindlesHeapType heapType) {
     auto heap = surfaceStateHeaps[heapType].get();
     if (heap->getAvailableSpace() < ssSize) {
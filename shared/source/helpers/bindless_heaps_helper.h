@@ -9,6 +9,7 @@
 #include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/heap_helper.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/utilities/atomic_bitset.h"
 
 #include <array>
 #include <memory>
@@ -76,6 +77,8 @@ class BindlessHeapsHelper {
     std::optional<AddressRange> reserveMemoryRange(size_t size, size_t alignment, HeapIndex heapIndex);
     bool initializeReservedMemory();
     bool isReservedMemoryModeAvailable();
+    void switchReusePools();
+    std::optional<SurfaceStateInHeapInfo> allocateFromReusePoolVector(size_t ssSize);
 
   protected:
     Device *rootDevice = nullptr;
@@ -93,7 +96,7 @@ class BindlessHeapsHelper {
     uint32_t releasePoolIndex = 0;
     bool allocateFromReusePool = false;
     std::array<std::vector<SurfaceStateInHeapInfo>, 2> surfaceStateInHeapVectorReuse[2];
-    std::bitset<64> stateCacheDirtyForContext;
+    AtomicBitset<64> stateCacheDirtyForContext;
 
     std::mutex mtx;
     DeviceBitfield deviceBitfield;
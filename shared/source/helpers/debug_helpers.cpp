@@ -9,6 +9,7 @@
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/abort.h"
+#include "shared/source/utilities/logger.h"
 
 #include <cassert>
 #include <cstdio>
@@ -24,6 +25,7 @@ void debugBreak(int line, const char *file) {
 void abortUnrecoverable(int line, const char *file) {
     printf("Abort was called at %d line in file:\n%s\n", line, file);
     fflush(stdout);
+    fileLoggerInstance().tryFlushLogFileBuffer();
     abortExecution();
 }
 } // namespace NEO
@@ -125,6 +125,30 @@ void InOrderExecInfo::reset() {
     initializeAllocationsFromHost();
 }
 
+bool InOrderExecInfo::isCounterReachedOnHost(uint64_t waitValue, uint32_t offset, uint32_t partitionOffset) {
+    if (offset == 0u && isCounterAlreadyDone(waitValue)) {
+        return true;
+    }
+
+    // host copy is not updated by simulated GPU
+    if (isTbx || !hostAddress) {
+        return false;
+    }
+
+    auto hostCounter = reinterpret_cast<volatile uint64_t *>(ptrOffset(hostAddress, offset));
+    for (uint32_t i = 0; i < numHostPartitionsToWait; i++) {
+        if (*hostCounter < waitValue) {
+            return false;
+        }
+        hostCounter = ptrOffset(hostCounter, partitionOffset);
+    }
+
+    if (offset == this->allocationOffset) {
+        setLastWaitedCounterValue(waitValue);
+    }
+    return true;
+}
+
 NEO::GraphicsAllocation *InOrderExecInfo::getDeviceCounterAllocation() const {
     if (externalDeviceAllocation) {
         return externalDeviceAllocation;
@@ -90,6 +90,7 @@ class InOrderExecInfo : public NEO::NonCopyableClass {
     bool isCounterAlreadyDone(uint64_t waitValue) const {
         return lastWaitedCounterValue >= waitValue && this->allocationOffset == 0u;
     }
+    bool isCounterReachedOnHost(uint64_t waitValue, uint32_t offset, uint32_t partitionOffset);
 
     NEO::GraphicsAllocation *getExternalHostAllocation() const { return externalHostAllocation; }
     NEO::GraphicsAllocation *getExternalDeviceAllocation() const { return externalDeviceAllocation; }
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/command_stream/preemption_mode.h"
+#include "shared/source/helpers/string.h"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class Device;
+
+struct DispatchWalkerTemplateKey {
+    const Device *device = nullptr;
+    int32_t defaultThreadArbitrationPolicy = 0;
+    int32_t kernelThreadArbitrationPolicy = 0;
+    PreemptionMode preemptionMode = PreemptionMode::Initial;
+    bool l0DebuggerActive = false;
+    bool heaplessMode = false;
+
+    bool operator==(const DispatchWalkerTemplateKey &other) const {
+        return device == other.device &&
+               defaultThreadArbitrationPolicy == other.defaultThreadArbitrationPolicy &&
+               kernelThreadArbitrationPolicy == other.kernelThreadArbitrationPolicy &&
+               preemptionMode == other.preemptionMode &&
+               l0DebuggerActive == other.l0DebuggerActive &&
+               heaplessMode == other.heaplessMode;
+    }
+};
+
+// Walker command with kernel fields that do not change between launches already programmed.
+// Stored on first dispatch of a kernel and reused by dispatches with matching key.
+class DispatchWalkerTemplate {
+  public:
+    bool load(const DispatchWalkerTemplateKey &key, void *walker, size_t walkerSize) const {
+        if (!valid.load(std::memory_order_acquire) || !(this->key == key) || walkerData.size() != walkerSize) {
+            return false;
+        }
+        memcpy_s(walker, walkerSize, walkerData.data(), walkerSize);
+        return true;
+    }
+
+    void store(const DispatchWalkerTemplateKey &key, const void *walker, size_t walkerSize) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (valid.load(std::memory_order_relaxed)) {
+            return;
+        }
+        this->key = key;
+        auto walkerBytes = static_cast<const uint8_t *>(walker);
+        walkerData.assign(walkerBytes, walkerBytes + walkerSize);
+        valid.store(true, std::memory_order_release);
+    }
+
+    bool isValid() const { return valid.load(std::memory_order_acquire); }
+
+  protected:
+    std::mutex mutex;
+    std::atomic<bool> valid{false};
+    DispatchWalkerTemplateKey key;
+    std::vector<uint8_t> walkerData;
+};
+} // namespace NEO
@@ -46,6 +46,12 @@ void PTE::pageWalk(uintptr_t vm, size_t size, size_t offset, uint64_t entryBits,
     uint64_t newEntryBits = entryBits & MemoryConstants::pageMask;
     newEntryBits |= 0x1;
 
+    // physically contiguous pages with the same entry bits are reported to the walker as a single run
+    uint64_t runPhysAddress = 0;
+    size_t runSize = 0;
+    size_t runOffset = offset;
+    uint64_t runEntryBits = 0;
+
     for (size_t index = indexStart; index <= indexEnd; index++) {
         if (entries[index] == 0x0) {
             uint64_t tmp = allocator->reserve4kPage(memoryBank);
@@ -56,12 +62,29 @@ void PTE::pageWalk(uintptr_t vm, size_t size, size_t offset, uint64_t entryBits,
         res = reinterpret_cast<uintptr_t>(entries[index]) & MemoryConstants::page4kEntryMask;
 
         size_t lSize = std::min(pageSize - rem, size);
-        pageWalker((res & ~0x1) + rem, lSize, offset, reinterpret_cast<uintptr_t>(entries[index]) & MemoryConstants::pageMask);
+        uint64_t physAddress = (res & ~0x1) + rem;
+        uint64_t pageEntryBits = reinterpret_cast<uintptr_t>(entries[index]) & MemoryConstants::pageMask;
+
+        if (runSize > 0 && runPhysAddress + runSize == physAddress && runEntryBits == pageEntryBits) {
+            runSize += lSize;
+        } else {
+            if (runSize > 0) {
+                pageWalker(runPhysAddress, runSize, runOffset, runEntryBits);
+            }
+            runPhysAddress = physAddress;
+            runSize = lSize;
+            runOffset = offset;
+            runEntryBits = pageEntryBits;
+        }
 
         size -= lSize;
         offset += lSize;
         rem = 0;
     }
+
+    if (runSize > 0) {
+        pageWalker(runPhysAddress, runSize, runOffset, runEntryBits);
+    }
 }
 
 template class PageTable<class PDP, 3, 9>;
@@ -187,6 +187,29 @@ std::string Drm::getSysFsPciPath() {
     return {};
 }
 
+int Drm::getDeviceNumaNode() {
+    const std::string fileName = std::string(Os::sysFsPciPathPrefix) + hwDeviceId->getPciPath() + "/numa_node";
+    int fd = SysCalls::open(fileName.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return -1;
+    }
+
+    std::string readString(16, '\0');
+    ssize_t bytesRead = SysCalls::pread(fd, readString.data(), readString.size() - 1, 0);
+    NEO::SysCalls::close(fd);
+    if (bytesRead <= 0) {
+        return -1;
+    }
+
+    char *endPtr = nullptr;
+    errno = 0;
+    auto numaNode = std::strtol(readString.data(), &endPtr, 10);
+    if ((endPtr == readString.data()) || (errno != 0) || (numaNode < 0)) {
+        return -1;
+    }
+    return static_cast<int>(numaNode);
+}
+
 bool Drm::readSysFsAsString(const std::string &relativeFilePath, std::string &readString) {
 
     auto devicePath = getSysFsPciPath();
@@ -1066,6 +1089,9 @@ bool Drm::queryMemoryInfo() {
     UNRECOVERABLE_IF(memoryInfoQueried);
     this->memoryInfo = ioctlHelper->createMemoryInfo();
     memoryInfoQueried = true;
+    if (this->memoryInfo && this->memoryInfo->isMemPolicySupported()) {
+        this->memoryInfo->setDeviceNumaNode(getDeviceNumaNode());
+    }
     return this->memoryInfo != nullptr;
 }
 
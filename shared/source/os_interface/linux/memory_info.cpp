@@ -18,6 +18,7 @@
 #include "shared/source/os_interface/product_helper.h"
 
 #include <iostream>
+#include <linux/mempolicy.h>
 
 namespace NEO {
 
@@ -73,7 +74,7 @@ int MemoryInfo::createGemExt(const MemRegionsVec &memClassInstances, size_t allo
     auto isCoherent = productHelper.isCoherentAllocation(patIndex);
     if (memPolicySupported &&
         isUSMHostAllocation &&
-        Linux::NumaLibrary::getMemPolicy(&mode, memPolicyNodeMask)) {
+        getHostAllocationMemPolicy(mode, memPolicyNodeMask)) {
         if (memPolicyMode != -1) {
             mode = memPolicyMode;
         }
@@ -83,6 +84,21 @@ int MemoryInfo::createGemExt(const MemRegionsVec &memClassInstances, size_t allo
     }
 }
 
+bool MemoryInfo::getHostAllocationMemPolicy(int &mode, std::vector<unsigned long> &nodeMask) {
+    int numaNode = deviceNumaNode;
+    if (debugManager.flags.OverrideHostAllocationMemPolicyNode.get() != -1) {
+        numaNode = debugManager.flags.OverrideHostAllocationMemPolicyNode.get();
+    }
+
+    if (numaNode >= 0 && Linux::NumaLibrary::getNodeMask(static_cast<uint32_t>(numaNode), nodeMask)) {
+        mode = MPOL_PREFERRED;
+        numaPlacedHostAllocations++;
+        return true;
+    }
+
+    return Linux::NumaLibrary::getMemPolicy(&mode, nodeMask);
+}
+
 uint32_t MemoryInfo::getLocalMemoryRegionIndex(DeviceBitfield deviceBitfield) const {
     UNRECOVERABLE_IF(deviceBitfield.count() != 1u);
     auto &hwInfo = *this->drm.getRootDeviceEnvironment().getHardwareInfo();
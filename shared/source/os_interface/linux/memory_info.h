@@ -8,6 +8,7 @@
 #pragma once
 #include "shared/source/os_interface/linux/ioctl_helper.h"
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <vector>
@@ -42,10 +43,13 @@ class MemoryInfo {
     MOCKABLE_VIRTUAL int createGemExtWithMultipleRegions(DeviceBitfield memoryBanks, size_t allocSize, uint32_t &handle, uint64_t patIndex, bool isUSMHostAllocation);
     MOCKABLE_VIRTUAL int createGemExtWithMultipleRegions(DeviceBitfield memoryBanks, size_t allocSize, uint32_t &handle, uint64_t patIndex, int32_t pairHandle, bool isChunked, uint32_t numOfChunks, bool isUSMHostAllocation);
     void populateTileToLocalMemoryRegionIndexMap();
+    bool getHostAllocationMemPolicy(int &mode, std::vector<unsigned long> &nodeMask);
 
     const RegionContainer &getLocalMemoryRegions() const { return localMemoryRegions; }
     const RegionContainer &getDrmRegionInfos() const { return drmQueryRegions; }
     bool isMemPolicySupported() const { return memPolicySupported; }
+    void setDeviceNumaNode(int numaNode) { deviceNumaNode = numaNode; }
+    uint64_t getNumaPlacedHostAllocationsCount() const { return numaPlacedHostAllocations.load(); }
 
   protected:
     const Drm &drm;
@@ -54,6 +58,8 @@ class MemoryInfo {
     const MemoryRegion &systemMemoryRegion;
     bool memPolicySupported;
     int memPolicyMode;
+    int deviceNumaNode = -1;
+    std::atomic<uint64_t> numaPlacedHostAllocations{0};
     RegionContainer localMemoryRegions;
     std::array<uint32_t, 4> tileToLocalMemoryRegionIndexMap{};
 };
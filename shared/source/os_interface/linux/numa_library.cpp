@@ -52,5 +52,15 @@ bool NumaLibrary::getMemPolicy(int *mode, std::vector<unsigned long> &nodeMask)
     return false;
 }
 
+bool NumaLibrary::getNodeMask(uint32_t nodeId, std::vector<unsigned long> &nodeMask) {
+    if (!numaLoaded || nodeId > static_cast<uint32_t>(maxNode)) {
+        return false;
+    }
+    constexpr uint32_t bitsPerMaskEntry = sizeof(unsigned long) * 8;
+    std::vector<unsigned long>(maxNode + 1, 0).swap(nodeMask);
+    nodeMask[nodeId / bitsPerMaskEntry] |= (1ul << (nodeId % bitsPerMaskEntry));
+    return true;
+}
+
 } // namespace Linux
 } // namespace NEO
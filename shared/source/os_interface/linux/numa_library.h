@@ -21,6 +21,7 @@ class NumaLibrary {
     static bool init();
     static bool isLoaded() { return numaLoaded; }
     static bool getMemPolicy(int *mode, std::vector<unsigned long> &nodeMask);
+    static bool getNodeMask(uint32_t nodeId, std::vector<unsigned long> &nodeMask);
 
   protected:
     static constexpr const char *numaLibNameStr = "libnuma.so.1";
@@ -7,6 +7,7 @@
 
 #include "shared/source/tbx/tbx_sockets_imp.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/string.h"
 
@@ -32,10 +33,12 @@ namespace NEO {
 
 TbxSocketsImp::TbxSocketsImp(std::ostream &err)
     : cerrStream(err) {
+    batchWrites = debugManager.flags.EnableTbxSocketWriteBatching.get() == 1;
 }
 
 void TbxSocketsImp::close() {
     if (0 != socket) {
+        flushPendingWrites();
 #ifdef WIN32
         ::shutdown(socket, 0x02 /*SD_BOTH*/);
 
@@ -94,7 +97,7 @@ bool TbxSocketsImp::init(const std::string &hostNameOrIp, uint16_t port) {
         cmd.u.controlReq.hasMask = 1;
         cmd.u.controlReq.has = 1;
 
-        sendWriteData(&cmd, sizeof(HasHdr) + cmd.hdr.size);
+        sendWriteRequest(&cmd, sizeof(HasHdr) + cmd.hdr.size, nullptr, 0);
     } while (false);
 
     return socket != INVALID_SOCKET;
@@ -132,6 +135,11 @@ bool TbxSocketsImp::connectToServer(const std::string &hostNameOrIp, uint16_t po
 bool TbxSocketsImp::readMMIO(uint32_t offset, uint32_t *data) {
     bool success;
     do {
+        success = flushPendingWrites();
+        if (!success) {
+            break;
+        }
+
         HasMsg cmd;
         memset(&cmd, 0, sizeof(cmd));
         cmd.hdr.msgType = HAS_MMIO_REQ_TYPE;
@@ -181,7 +189,7 @@ bool TbxSocketsImp::writeMMIO(uint32_t offset, uint32_t value) {
     cmd.u.mmioReq.write = 1;
     cmd.u.mmioReq.size = sizeof(uint32_t);
 
-    return sendWriteData(&cmd, sizeof(HasHdr) + cmd.hdr.size);
+    return sendWriteRequest(&cmd, sizeof(HasHdr) + cmd.hdr.size, nullptr, 0);
 }
 
 bool TbxSocketsImp::readMemory(uint64_t addrOffset, void *data, size_t size) {
@@ -200,6 +208,11 @@ bool TbxSocketsImp::readMemory(uint64_t addrOffset, void *data, size_t size) {
 
     bool success;
     do {
+        success = flushPendingWrites();
+        if (!success) {
+            break;
+        }
+
         success = sendWriteData(&cmd, sizeof(HasHdr) + sizeof(HasReadDataReq));
         if (!success) {
             break;
@@ -225,6 +238,10 @@ bool TbxSocketsImp::readMemory(uint64_t addrOffset, void *data, size_t size) {
 }
 
 bool TbxSocketsImp::writeMemory(uint64_t physAddr, const void *data, size_t size, uint32_t type) {
+    if (batchWrites && coalesceMemoryWrite(physAddr, data, size, type)) {
+        return true;
+    }
+
     HasMsg cmd;
     memset(&cmd, 0, sizeof(cmd));
     cmd.hdr.msgType = HAS_WRITE_DATA_REQ_TYPE;
@@ -242,6 +259,18 @@ bool TbxSocketsImp::writeMemory(uint64_t physAddr, const void *data, size_t size
 
     bool success;
     do {
+        if (batchWrites && size < maxPendingWritesSize) {
+            lastMemoryWriteOffset = pendingWrites.size();
+            lastMemoryWriteEnd = physAddr + size;
+            success = sendWriteRequest(&cmd, sizeof(HasHdr) + sizeof(HasWriteDataReq), data, size);
+            break;
+        }
+
+        success = flushPendingWrites();
+        if (!success) {
+            break;
+        }
+
         success = sendWriteData(&cmd, sizeof(HasHdr) + sizeof(HasWriteDataReq));
         if (!success) {
             break;
@@ -258,6 +287,32 @@ bool TbxSocketsImp::writeMemory(uint64_t physAddr, const void *data, size_t size
     return success;
 }
 
+bool TbxSocketsImp::coalesceMemoryWrite(uint64_t physAddr, const void *data, size_t size, uint32_t type) {
+    if (lastMemoryWriteOffset == noPendingMemoryWrite || physAddr != lastMemoryWriteEnd) {
+        return false;
+    }
+
+    HasMsg lastCmd;
+    memcpy_s(&lastCmd, sizeof(HasHdr) + sizeof(HasWriteDataReq), &pendingWrites[lastMemoryWriteOffset], sizeof(HasHdr) + sizeof(HasWriteDataReq));
+    const size_t mergedSize = static_cast<size_t>(lastCmd.u.writeReq.size) + size;
+    if (lastCmd.u.writeReq.memoryType != type || mergedSize >= maxPendingWritesSize ||
+        ((physAddr + size - 1) >> 32) != lastCmd.u.writeReq.addressH) {
+        return false;
+    }
+
+    lastCmd.u.writeReq.size = static_cast<uint32_t>(mergedSize);
+    memcpy_s(&pendingWrites[lastMemoryWriteOffset], sizeof(HasHdr) + sizeof(HasWriteDataReq), &lastCmd, sizeof(HasHdr) + sizeof(HasWriteDataReq));
+
+    auto dataBytes = reinterpret_cast<const char *>(data);
+    pendingWrites.insert(pendingWrites.end(), dataBytes, dataBytes + size);
+    lastMemoryWriteEnd += size;
+
+    if (pendingWrites.size() >= maxPendingWritesSize) {
+        return flushPendingWrites();
+    }
+    return true;
+}
+
 bool TbxSocketsImp::writeGTT(uint32_t offset, uint64_t entry) {
     HasMsg cmd;
     memset(&cmd, 0, sizeof(cmd));
@@ -269,7 +324,43 @@ bool TbxSocketsImp::writeGTT(uint32_t offset, uint64_t entry) {
     cmd.u.gtt64Req.data = static_cast<uint32_t>(entry & 0xffffffff);
     cmd.u.gtt64Req.dataH = static_cast<uint32_t>(entry >> 32);
 
-    return sendWriteData(&cmd, sizeof(HasHdr) + cmd.hdr.size);
+    return sendWriteRequest(&cmd, sizeof(HasHdr) + cmd.hdr.size, nullptr, 0);
+}
+
+bool TbxSocketsImp::sendWriteRequest(const void *header, size_t headerSize, const void *data, size_t dataSize) {
+    if (!batchWrites) {
+        bool success = sendWriteData(header, headerSize);
+        if (success && dataSize > 0) {
+            success = sendWriteData(data, dataSize);
+        }
+        return success;
+    }
+
+    auto headerBytes = reinterpret_cast<const char *>(header);
+    pendingWrites.insert(pendingWrites.end(), headerBytes, headerBytes + headerSize);
+    if (dataSize > 0) {
+        auto dataBytes = reinterpret_cast<const char *>(data);
+        pendingWrites.insert(pendingWrites.end(), dataBytes, dataBytes + dataSize);
+    } else {
+        // only a memory write placed last in the queue can be extended
+        lastMemoryWriteOffset = noPendingMemoryWrite;
+    }
+
+    if (pendingWrites.size() >= maxPendingWritesSize) {
+        return flushPendingWrites();
+    }
+    return true;
+}
+
+bool TbxSocketsImp::flushPendingWrites() {
+    lastMemoryWriteOffset = noPendingMemoryWrite;
+    if (pendingWrites.empty()) {
+        return true;
+    }
+
+    auto success = sendWriteData(pendingWrites.data(), pendingWrites.size());
+    pendingWrites.clear();
+    return success;
 }
 
 bool TbxSocketsImp::sendWriteData(const void *buffer, size_t sizeInBytes) {
@@ -12,6 +12,8 @@
 
 #include <cstdint>
 #include <iostream>
+#include <limits>
+#include <vector>
 
 namespace NEO {
 
@@ -36,13 +38,24 @@ class TbxSocketsImp : public TbxSockets {
     SOCKET socket = 0;
 
     bool connectToServer(const std::string &hostNameOrIp, uint16_t port);
-    bool sendWriteData(const void *buffer, size_t sizeInBytes);
-    bool getResponseData(void *buffer, size_t sizeInBytes);
+    MOCKABLE_VIRTUAL bool sendWriteData(const void *buffer, size_t sizeInBytes);
+    MOCKABLE_VIRTUAL bool getResponseData(void *buffer, size_t sizeInBytes);
+    bool sendWriteRequest(const void *header, size_t headerSize, const void *data, size_t dataSize);
+    bool coalesceMemoryWrite(uint64_t physAddr, const void *data, size_t size, uint32_t type);
+    bool flushPendingWrites();
 
     inline uint32_t getNextTransID() { return transID++; }
 
     void logErrorInfo(const char *tag);
 
+    static constexpr size_t maxPendingWritesSize = 4 * 1024 * 1024;
+    static constexpr size_t noPendingMemoryWrite = std::numeric_limits<size_t>::max();
+
     uint32_t transID = 0;
+
+    bool batchWrites = false;
+    std::vector<char> pendingWrites;
+    size_t lastMemoryWriteOffset = noPendingMemoryWrite;
+    uint64_t lastMemoryWriteEnd = 0;
 };
 } // namespace NEO
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace NEO {
+
+// Subset of std::bitset interface backed by a single atomic word, safe to query and modify without external locking
+template <size_t bitsCount>
+class AtomicBitset {
+    static_assert(bitsCount > 0 && bitsCount <= 64, "AtomicBitset supports up to 64 bits");
+
+  public:
+    static constexpr uint64_t allBitsMask = bitsCount == 64 ? std::numeric_limits<uint64_t>::max() : ((1ull << bitsCount) - 1);
+
+    constexpr size_t size() const { return bitsCount; }
+
+    bool test(size_t pos) const {
+        return (bits.load(std::memory_order_acquire) & getBitMask(pos)) != 0;
+    }
+
+    AtomicBitset &set() {
+        bits.store(allBitsMask, std::memory_order_release);
+        return *this;
+    }
+
+    AtomicBitset &set(size_t pos) {
+        bits.fetch_or(getBitMask(pos), std::memory_order_acq_rel);
+        return *this;
+    }
+
+    AtomicBitset &reset() {
+        bits.store(0u, std::memory_order_release);
+        return *this;
+    }
+
+    AtomicBitset &reset(size_t pos) {
+        bits.fetch_and(~getBitMask(pos), std::memory_order_acq_rel);
+        return *this;
+    }
+
+    bool any() const { return bits.load(std::memory_order_acquire) != 0; }
+    unsigned long to_ulong() const { return static_cast<unsigned long>(bits.load(std::memory_order_acquire)); }  // NOLINT(readability-identifier-naming)
+    unsigned long long to_ullong() const { return bits.load(std::memory_order_acquire); }                       // NOLINT(readability-identifier-naming)
+
+  protected:
+    static uint64_t getBitMask(size_t pos) {
+        return pos < bitsCount ? (1ull << pos) : 0u;
+    }
+
+    std::atomic<uint64_t> bits{0u};
+};
+
+} // namespace NEO
@@ -14,14 +14,37 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/utilities/io_functions.h"
 
+#include <cstdlib>
+#include <exception>
 #include <fstream>
 #include <memory>
 #include <string>
 
 namespace NEO {
 
+namespace {
+std::terminate_handler previousTerminateHandler = nullptr;
+
+[[noreturn]] void flushLogFileBufferAndTerminate() {
+    fileLoggerInstance().tryFlushLogFileBuffer();
+    if (previousTerminateHandler != nullptr) {
+        previousTerminateHandler();
+    }
+    std::abort();
+}
+} // namespace
+
 FileLogger<globalDebugFunctionalityLevel> &fileLoggerInstance() {
     static FileLogger<globalDebugFunctionalityLevel> fileLoggerInstance(std::string("igdrcl.log"), debugManager.flags);
+    // buffered messages would otherwise be lost when the process ends through std::terminate
+    static const bool flushOnTerminateInstalled = [] {
+        if (fileLoggerInstance.getLogFileBufferSize() == 0u) {
+            return false;
+        }
+        previousTerminateHandler = std::set_terminate(flushLogFileBufferAndTerminate);
+        return true;
+    }();
+    (void)flushOnTerminateInstalled;
     return fileLoggerInstance;
 }
 
@@ -37,10 +60,17 @@ FileLogger<debugLevel>::FileLogger(std::string filename, const DebugVariables &f
     logAllocationMemoryPool = flags.LogAllocationMemoryPool.get();
     logAllocationType = flags.LogAllocationType.get();
     logAllocationStdout = flags.LogAllocationStdout.get();
+
+    if (enabled() && flags.LogFileBufferSize.get() > 0) {
+        logFileBufferSize = static_cast<size_t>(flags.LogFileBufferSize.get());
+        logFileBuffer.reserve(logFileBufferSize);
+    }
 }
 
 template <DebugFunctionalityLevel debugLevel>
-FileLogger<debugLevel>::~FileLogger() = default;
+FileLogger<debugLevel>::~FileLogger() {
+    flushLogFileBuffer();
+}
 
 template <DebugFunctionalityLevel debugLevel>
 void FileLogger<debugLevel>::writeToFile(std::string filename, const char *str, size_t length, std::ios_base::openmode mode) {
@@ -52,11 +82,46 @@ void FileLogger<debugLevel>::writeToFile(std::string filename, const char *str,
     }
 }
 
+template <DebugFunctionalityLevel debugLevel>
+void FileLogger<debugLevel>::writeToLogFile(const char *str, size_t length) {
+    if (logFileBufferSize == 0u) {
+        writeToFile(logFileName, str, length, std::ios::app);
+        return;
+    }
+
+    // batch messages so that file is opened once per buffer instead of once per line
+    std::lock_guard<std::mutex> lock(logFileBufferMutex);
+    logFileBuffer.append(str, length);
+    if (logFileBuffer.size() >= logFileBufferSize) {
+        writeToFile(logFileName, logFileBuffer.c_str(), logFileBuffer.size(), std::ios::app);
+        logFileBuffer.clear();
+    }
+}
+
+template <DebugFunctionalityLevel debugLevel>
+void FileLogger<debugLevel>::flushLogFileBuffer() {
+    std::lock_guard<std::mutex> lock(logFileBufferMutex);
+    if (!logFileBuffer.empty()) {
+        writeToFile(logFileName, logFileBuffer.c_str(), logFileBuffer.size(), std::ios::app);
+        logFileBuffer.clear();
+    }
+}
+
+template <DebugFunctionalityLevel debugLevel>
+void FileLogger<debugLevel>::tryFlushLogFileBuffer() {
+    // used on abnormal termination, where the buffer may be locked by the failing thread
+    std::unique_lock<std::mutex> lock(logFileBufferMutex, std::try_to_lock);
+    if (lock.owns_lock() && !logFileBuffer.empty()) {
+        writeToFile(logFileName, logFileBuffer.c_str(), logFileBuffer.size(), std::ios::app);
+        logFileBuffer.clear();
+    }
+}
+
 template <DebugFunctionalityLevel debugLevel>
 void FileLogger<debugLevel>::logDebugString(bool enableLog, std::string_view debugString) {
     if (enabled()) {
         if (enableLog) {
-            writeToFile(logFileName, debugString.data(), debugString.size(), std::ios::app);
+            writeToLogFile(debugString.data(), debugString.size());
         }
     }
 }
@@ -91,7 +156,10 @@ void FileLogger<debugLevel>::logApiCall(const char *function, bool enter, int32_
         ss << function << std::endl;
 
         auto str = ss.str();
-        writeToFile(logFileName, str.c_str(), str.size(), std::ios::app);
+        writeToLogFile(str.c_str(), str.size());
+        if (!enter && errorCode != 0) {
+            flushLogFileBuffer();
+        }
     }
 }
 
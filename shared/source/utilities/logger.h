@@ -44,6 +44,9 @@ class FileLogger {
     size_t getInput(const size_t *input, int32_t index);
 
     MOCKABLE_VIRTUAL void writeToFile(std::string filename, const char *str, size_t length, std::ios_base::openmode mode);
+    void writeToLogFile(const char *str, size_t length);
+    void flushLogFileBuffer();
+    void tryFlushLogFileBuffer();
 
     void dumpBinaryProgram(int32_t numDevices, const size_t *lengths, const unsigned char **binaries);
 
@@ -104,7 +107,7 @@ class FileLogger {
                 ss << "------------------------------" << std::endl;
 
                 const auto str = ss.str();
-                writeToFile(logFileName, str.c_str(), str.length(), std::ios::app);
+                writeToLogFile(str.c_str(), str.length());
             }
         }
     }
@@ -127,7 +130,7 @@ class FileLogger {
                 print(ss, "ThreadID", thisThread, params...);
 
                 const auto str = ss.str();
-                writeToFile(logFileName, str.c_str(), str.length(), std::ios::app);
+                writeToLogFile(str.c_str(), str.length());
             }
         }
     }
@@ -143,10 +146,14 @@ class FileLogger {
     bool shouldLogAllocationType() { return logAllocationType; }
     bool shouldLogAllocationToStdout() { return logAllocationStdout; }
     bool shouldLogAllocationMemoryPool() { return logAllocationMemoryPool; }
+    size_t getLogFileBufferSize() const { return logFileBufferSize; }
 
   protected:
     std::mutex mutex;
+    std::mutex logFileBufferMutex;
     std::string logFileName;
+    std::string logFileBuffer;
+    size_t logFileBufferSize = 0u;
     bool dumpKernels = false;
     bool logApiCalls = false;
     bool logAllocationMemoryPool = false;
@@ -62,7 +62,7 @@ void logAllocation(FileLogger<level> &logger, GraphicsAllocation const *graphics
         }
 
         if (logger.enabled()) {
-            logger.writeToFile(logger.getLogFileNameString(), str.c_str(), str.size(), std::ios::app);
+            logger.writeToLogFile(str.c_str(), str.size());
         }
     }
 }
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/streaming_memcpy.h"
+
+#include "shared/source/helpers/string.h"
+#include "shared/source/utilities/cpuintrinsics.h"
+
+#if defined(__ARM_ARCH)
+#include <sse2neon.h>
+#else
+#include <emmintrin.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+
+namespace NEO {
+
+void streamingMemcpy(void *dst, const void *src, size_t size) {
+    constexpr size_t vectorSize = sizeof(__m128i);
+
+    auto dstBytes = static_cast<uint8_t *>(dst);
+    auto srcBytes = static_cast<const uint8_t *>(src);
+
+    size_t headSize = (vectorSize - (reinterpret_cast<uintptr_t>(dstBytes) & (vectorSize - 1))) & (vectorSize - 1);
+    headSize = std::min(headSize, size);
+    if (headSize > 0) {
+        memcpy_s(dstBytes, headSize, srcBytes, headSize);
+        dstBytes += headSize;
+        srcBytes += headSize;
+        size -= headSize;
+    }
+
+    size_t vectorCount = size / vectorSize;
+    for (size_t i = 0; i < vectorCount; i++) {
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dstBytes), _mm_loadu_si128(reinterpret_cast<const __m128i *>(srcBytes)));
+        dstBytes += vectorSize;
+        srcBytes += vectorSize;
+    }
+
+    size_t tailSize = size - vectorCount * vectorSize;
+    if (tailSize > 0) {
+        memcpy_s(dstBytes, tailSize, srcBytes, tailSize);
+    }
+
+    CpuIntrinsics::sfence();
+}
+
+} // namespace NEO
@@ -0,0 +1,18 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace NEO {
+
+// Copies with non-temporal stores, meant for write-combined destinations such as locked device memory.
+// Stores are fenced before returning.
+void streamingMemcpy(void *dst, const void *src, size_t size);
+
+} // namespace NEO
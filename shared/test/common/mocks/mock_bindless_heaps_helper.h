@@ -41,6 +41,7 @@ class MockBindlesHeapsHelper : public BindlessHeapsHelper {
     using BaseClass::isMultiOsContextCapable;
     using BaseClass::isReservedMemoryModeAvailable;
     using BaseClass::memManager;
+    using BaseClass::mtx;
     using BaseClass::releasePoolIndex;
     using BaseClass::reservedMemoryInitialized;
     using BaseClass::reservedRangeBase;
@@ -22,6 +22,7 @@ template <DebugFunctionalityLevel debugLevel>
 class TestFileLogger : public NEO::FileLogger<debugLevel> {
   public:
     using NEO::FileLogger<debugLevel>::FileLogger;
+    using NEO::FileLogger<debugLevel>::logFileBufferMutex;
 
     TestFileLogger(std::string filename, const NEO::DebugVariables &flags) : NEO::FileLogger<debugLevel>(filename, flags) {
         if (NEO::FileLogger<debugLevel>::enabled() && virtualFileExists(this->getLogFileName())) {
@@ -1011,6 +1011,30 @@ HWTEST_F(CommandContainerTest, givenCmdContainerWhenReuseExistingCmdBufferWithAl
     allocList.freeAllGraphicsAllocations(pDevice);
 }
 
+HWTEST_F(CommandContainerTest, givenCmdContainerWhenReuseExistingCmdBufferWithEmptyImmediateListAndCompletedAllocationInSharedListThenSharedAllocationIsReturned) {
+    auto cmdContainer = std::make_unique<MyMockCommandContainer>();
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    *csr.tagAddress = 10u;
+
+    AllocationsList allocList;
+    cmdContainer->initialize(pDevice, &allocList, HeapSize::defaultHeapSize, false, false);
+    cmdContainer->setImmediateCmdListCsr(&csr);
+    cmdContainer->immediateReusableAllocationList = std::make_unique<NEO::AllocationsList>();
+
+    auto sharedAllocation = cmdContainer->allocateCommandBuffer(false);
+    ASSERT_NE(nullptr, sharedAllocation);
+    sharedAllocation->updateTaskCount(10, csr.getOsContext().getContextId());
+    allocList.pushFrontOne(*sharedAllocation);
+
+    auto currectContainerSize = cmdContainer->getCmdBufferAllocations().size();
+    EXPECT_EQ(sharedAllocation, cmdContainer->reuseExistingCmdBuffer());
+    EXPECT_TRUE(allocList.peekIsEmpty());
+    EXPECT_EQ(currectContainerSize + 1, cmdContainer->getCmdBufferAllocations().size());
+
+    cmdContainer.reset();
+    allocList.freeAllGraphicsAllocations(pDevice);
+}
+
 HWTEST_F(CommandContainerTest, GivenCmdContainerWhenContainerIsInitializedThenSurfaceStateIndirectHeapSizeIsCorrect) {
     MyMockCommandContainer cmdContainer;
     cmdContainer.initialize(pDevice, nullptr, HeapSize::defaultHeapSize, true, false);
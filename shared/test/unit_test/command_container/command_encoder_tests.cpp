@@ -294,6 +294,41 @@ HWTEST_F(CommandEncoderTests, givenInOrderExecutionInfoWhenSetLastCounterValueIs
     EXPECT_FALSE(inOrderExecInfo->isCounterAlreadyDone(0u));
 }
 
+HWTEST_F(CommandEncoderTests, givenInOrderExecutionInfoWhenCheckingIfCounterIsReachedOnHostThenHostCounterIsComparedAndCached) {
+    MockDevice mockDevice;
+
+    MockTagAllocator<DeviceAllocNodeType<true>> tagAllocator(0, mockDevice.getMemoryManager());
+    auto node = tagAllocator.getTag();
+
+    auto inOrderExecInfo = std::make_unique<InOrderExecInfo>(node, nullptr, mockDevice, 1, false, false);
+    auto hostCounter = inOrderExecInfo->getBaseHostAddress();
+    *hostCounter = 2u;
+
+    EXPECT_FALSE(inOrderExecInfo->isCounterReachedOnHost(3u, 0u, sizeof(uint64_t)));
+    EXPECT_FALSE(inOrderExecInfo->isCounterAlreadyDone(2u));
+
+    EXPECT_TRUE(inOrderExecInfo->isCounterReachedOnHost(2u, 0u, sizeof(uint64_t)));
+    EXPECT_TRUE(inOrderExecInfo->isCounterAlreadyDone(2u));
+
+    *hostCounter = 0u;
+    EXPECT_TRUE(inOrderExecInfo->isCounterReachedOnHost(1u, 0u, sizeof(uint64_t)));
+    EXPECT_FALSE(inOrderExecInfo->isCounterReachedOnHost(3u, 0u, sizeof(uint64_t)));
+}
+
+HWTEST_F(CommandEncoderTests, givenTbxModeWhenCheckingIfInOrderCounterIsReachedOnHostThenHostCounterIsNotTrusted) {
+    MockDevice mockDevice;
+    auto &csr = mockDevice.getUltCommandStreamReceiver<FamilyType>();
+    csr.commandStreamReceiverType = CommandStreamReceiverType::tbx;
+
+    MockTagAllocator<DeviceAllocNodeType<true>> tagAllocator(0, mockDevice.getMemoryManager());
+    auto node = tagAllocator.getTag();
+
+    auto inOrderExecInfo = std::make_unique<InOrderExecInfo>(node, nullptr, mockDevice, 1, false, false);
+    *inOrderExecInfo->getBaseHostAddress() = 2u;
+
+    EXPECT_FALSE(inOrderExecInfo->isCounterReachedOnHost(2u, 0u, sizeof(uint64_t)));
+}
+
 HWTEST_F(CommandEncoderTests, givenInOrderExecutionInfoWhenResetCalledThenUploadToTbx) {
     MockDevice mockDevice;
     auto &csr = mockDevice.getUltCommandStreamReceiver<FamilyType>();
@@ -1023,3 +1023,59 @@ HWTEST_F(AubFileStreamTests, givenAubCommandStreamReceiverWithAubManagerWhenInit
 
     EXPECT_EQ(expectedAddedComments, mockAubManager->receivedComments);
 }
+
+struct CapturingAubFileStream : public AubMemDump::AubFileStream {
+    using AubMemDump::AubFileStream::maxPendingBytes;
+    using AubMemDump::AubFileStream::startAsyncWriter;
+
+    ~CapturingAubFileStream() override {
+        stopAsyncWriter();
+    }
+
+    void writeToFile(const char *data, size_t size) override {
+        output.append(data, size);
+    }
+
+    std::string output;
+};
+
+TEST(AubFileStreamAsyncWriterTests, givenAsyncWriterWhenRecordsAreWrittenThenOutputIsIdenticalToSynchronousWriter) {
+    CapturingAubFileStream syncStream;
+    CapturingAubFileStream asyncStream;
+    asyncStream.startAsyncWriter();
+    asyncStream.maxPendingBytes = 1;
+    EXPECT_FALSE(syncStream.isAsyncWriterActive());
+    EXPECT_TRUE(asyncStream.isAsyncWriterActive());
+
+    std::vector<uint8_t> payload(3 * MemoryConstants::megaByte + 3);
+    for (size_t i = 0; i < payload.size(); i++) {
+        payload[i] = static_cast<uint8_t>(i);
+    }
+
+    for (auto stream : {&syncStream, &asyncStream}) {
+        stream->init(0, 0);
+        for (uint64_t i = 0; i < 4; i++) {
+            stream->writeMemory(i * MemoryConstants::pageSize, payload.data(), payload.size(), 0, 0);
+        }
+        stream->writePTE(0x2000, 0x3000, 0);
+        stream->writeMMIO(0x2000, 0x1);
+        stream->addComment("async writer");
+        stream->flush();
+    }
+
+    EXPECT_TRUE(asyncStream.isAsyncWriterActive());
+    EXPECT_EQ(syncStream.output.size(), asyncStream.output.size());
+    EXPECT_TRUE(syncStream.output == asyncStream.output);
+}
+
+TEST(AubFileStreamAsyncWriterTests, givenAsyncWriterWithBufferedRecordsWhenClosingStreamThenRecordsAreWrittenAndWriterIsStopped) {
+    CapturingAubFileStream asyncStream;
+    asyncStream.startAsyncWriter();
+
+    asyncStream.addComment("async writer");
+    EXPECT_TRUE(asyncStream.output.empty());
+
+    asyncStream.close();
+    EXPECT_FALSE(asyncStream.isAsyncWriterActive());
+    EXPECT_FALSE(asyncStream.output.empty());
+}
@@ -223,6 +223,122 @@ HWTEST_F(TbxCommandStreamTests, givenTbxCommandStreamReceiverWhenWriteMemoryIsCa
     memoryManager->freeGraphicsMemory(graphicsAllocation);
 }
 
+HWTEST_F(TbxCommandStreamTests, givenDeltaUploadsEnabledWhenAllocationIsWrittenAgainThenOnlyModifiedPagesAreWritten) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableTbxDeltaUploads.set(1);
+
+    TbxCommandStreamReceiverHw<FamilyType> *tbxCsr = (TbxCommandStreamReceiverHw<FamilyType> *)pCommandStreamReceiver;
+    tbxCsr->initializeEngine();
+    MemoryManager *memoryManager = tbxCsr->getMemoryManager();
+    ASSERT_NE(nullptr, memoryManager);
+
+    auto graphicsAllocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{pCommandStreamReceiver->getRootDeviceIndex(), 4 * MemoryConstants::pageSize});
+    ASSERT_NE(nullptr, graphicsAllocation);
+    auto size = graphicsAllocation->getUnderlyingBufferSize();
+    auto cpuAddress = static_cast<uint8_t *>(graphicsAllocation->getUnderlyingBuffer());
+    memset(cpuAddress, 0, size);
+
+    EXPECT_TRUE(tbxCsr->writeMemory(*graphicsAllocation));
+    EXPECT_EQ(size, tbxCsr->deltaUploadWrittenBytes);
+    EXPECT_EQ(0u, tbxCsr->deltaUploadSkippedBytes);
+
+    cpuAddress[2 * MemoryConstants::pageSize] = 1;
+    tbxCsr->setTbxWritable(true, *graphicsAllocation);
+    EXPECT_TRUE(tbxCsr->writeMemory(*graphicsAllocation));
+    EXPECT_EQ(size + MemoryConstants::pageSize, tbxCsr->deltaUploadWrittenBytes);
+    EXPECT_EQ(size - MemoryConstants::pageSize, tbxCsr->deltaUploadSkippedBytes);
+
+    memoryManager->freeGraphicsMemory(graphicsAllocation);
+}
+
+HWTEST_F(TbxCommandStreamTests, givenDeltaUploadsDisabledWhenAllocationIsWrittenAgainThenPagesAreNotTracked) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableTbxDeltaUploads.set(0);
+
+    TbxCommandStreamReceiverHw<FamilyType> *tbxCsr = (TbxCommandStreamReceiverHw<FamilyType> *)pCommandStreamReceiver;
+    tbxCsr->initializeEngine();
+    MemoryManager *memoryManager = tbxCsr->getMemoryManager();
+    ASSERT_NE(nullptr, memoryManager);
+
+    auto graphicsAllocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{pCommandStreamReceiver->getRootDeviceIndex(), MemoryConstants::pageSize});
+    ASSERT_NE(nullptr, graphicsAllocation);
+
+    EXPECT_TRUE(tbxCsr->writeMemory(*graphicsAllocation));
+    tbxCsr->setTbxWritable(true, *graphicsAllocation);
+    EXPECT_TRUE(tbxCsr->writeMemory(*graphicsAllocation));
+    EXPECT_TRUE(tbxCsr->uploadedPagesStates.empty());
+    EXPECT_EQ(0u, tbxCsr->deltaUploadWrittenBytes);
+    EXPECT_EQ(0u, tbxCsr->deltaUploadSkippedBytes);
+
+    memoryManager->freeGraphicsMemory(graphicsAllocation);
+}
+
+HWTEST_F(TbxCommandStreamTests, givenDeltaUploadsEnabledWhenAllocationIsMadeResidentThenPagesStateIsDroppedUntilAllocationIsDownloaded) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableTbxDeltaUploads.set(1);
+
+    MockTbxCsr<FamilyType> tbxCsr(*pDevice->executionEnvironment, pDevice->getDeviceBitfield());
+    MockOsContext osContext(0, EngineDescriptorHelper::getDefaultDescriptor(pDevice->getDeviceBitfield()));
+    tbxCsr.setupContext(osContext);
+    tbxCsr.initializeEngine();
+
+    constexpr size_t size = 2 * MemoryConstants::pageSize;
+    alignas(MemoryConstants::pageSize) uint8_t buffer[size] = {};
+    MockGraphicsAllocation allocation(buffer, size);
+
+    EXPECT_TRUE(tbxCsr.writeMemory(allocation));
+    EXPECT_EQ(1u, tbxCsr.uploadedPagesStates.count(&allocation));
+
+    ResidencyContainer allocationsForResidency = {&allocation};
+    tbxCsr.processResidency(allocationsForResidency, 0u);
+    EXPECT_EQ(0u, tbxCsr.uploadedPagesStates.count(&allocation));
+
+    tbxCsr.setTbxWritable(true, allocation);
+    EXPECT_TRUE(tbxCsr.writeMemory(allocation));
+    EXPECT_EQ(2 * size, tbxCsr.deltaUploadWrittenBytes);
+    EXPECT_EQ(0u, tbxCsr.deltaUploadSkippedBytes);
+
+    tbxCsr.processResidency(allocationsForResidency, 0u);
+    tbxCsr.downloadAllocation(allocation);
+    EXPECT_EQ(1u, tbxCsr.uploadedPagesStates.count(&allocation));
+
+    tbxCsr.setTbxWritable(true, allocation);
+    EXPECT_TRUE(tbxCsr.writeMemory(allocation));
+    EXPECT_EQ(2 * size, tbxCsr.deltaUploadWrittenBytes);
+    EXPECT_EQ(size, tbxCsr.deltaUploadSkippedBytes);
+}
+
+HWTEST_F(TbxCommandStreamTests, givenDeltaUploadsEnabledWhenReadOnlyAllocationIsMadeResidentThenPagesStateIsKept) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableTbxDeltaUploads.set(1);
+
+    MockTbxCsr<FamilyType> tbxCsr(*pDevice->executionEnvironment, pDevice->getDeviceBitfield());
+    MockOsContext osContext(0, EngineDescriptorHelper::getDefaultDescriptor(pDevice->getDeviceBitfield()));
+    tbxCsr.setupContext(osContext);
+    tbxCsr.initializeEngine();
+
+    constexpr size_t size = 2 * MemoryConstants::pageSize;
+    alignas(MemoryConstants::pageSize) uint8_t buffer[size] = {};
+    MockGraphicsAllocation allocation(buffer, size);
+    allocation.setAllocationType(AllocationType::commandBuffer);
+    ASSERT_TRUE(allocation.hasAllocationReadOnlyType());
+
+    EXPECT_TRUE(tbxCsr.writeMemory(allocation));
+    ResidencyContainer allocationsForResidency = {&allocation};
+    tbxCsr.processResidency(allocationsForResidency, 0u);
+    EXPECT_EQ(1u, tbxCsr.uploadedPagesStates.count(&allocation));
+
+    buffer[0] = 1;
+    tbxCsr.setTbxWritable(true, allocation);
+    EXPECT_TRUE(tbxCsr.writeMemory(allocation));
+    EXPECT_EQ(size + MemoryConstants::pageSize, tbxCsr.deltaUploadWrittenBytes);
+    EXPECT_EQ(MemoryConstants::pageSize, tbxCsr.deltaUploadSkippedBytes);
+
+    allocation.setAsCantBeReadOnly(true);
+    tbxCsr.processResidency(allocationsForResidency, 0u);
+    EXPECT_EQ(0u, tbxCsr.uploadedPagesStates.count(&allocation));
+}
+
 HWTEST_F(TbxCommandStreamTests, givenTbxCommandStreamReceiverWhenWriteMemoryIsCalledForGraphicsAllocationWithZeroSizeThenItShouldReturnFalse) {
     TbxCommandStreamReceiverHw<FamilyType> *tbxCsr = (TbxCommandStreamReceiverHw<FamilyType> *)pCommandStreamReceiver;
     tbxCsr->initializeEngine();
@@ -7,6 +7,8 @@
 
 #include "shared/source/command_stream/tbx_command_stream_receiver_hw.h"
 #include "shared/source/tbx/tbx_proto.h"
+#include "shared/source/tbx/tbx_sockets_imp.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_tbx_sockets.h"
 #include "shared/test/unit_test/mocks/mock_tbx_stream.h"
 
@@ -37,3 +39,91 @@ TEST(TbxStreamTests, givenTbxStreamWhenWriteMemoryIsCalledThenMemTypeIsSetCorrec
     mockTbxStream->writePTE(0, 0, addressSpace);
     EXPECT_EQ(MemType::system, mockTbxSocket->typeCapturedFromWriteMemory);
 }
+
+struct CapturingTbxSocketsImp : public TbxSocketsImp {
+    using TbxSocketsImp::pendingWrites;
+
+    bool sendWriteData(const void *buffer, size_t sizeInBytes) override {
+        auto bytes = reinterpret_cast<const char *>(buffer);
+        sentMessages.emplace_back(bytes, bytes + sizeInBytes);
+        return true;
+    }
+
+    bool getResponseData(void *buffer, size_t sizeInBytes) override {
+        HasMsg resp = {};
+        resp.hdr.msgType = HAS_MMIO_RES_TYPE;
+        resp.hdr.transID = transID - 1;
+        resp.u.mmioRes.data = 0x1234;
+        memcpy(buffer, &resp, std::min(sizeInBytes, sizeof(resp)));
+        return true;
+    }
+
+    std::vector<std::vector<char>> sentMessages;
+};
+
+TEST(TbxSocketsImpTests, givenWriteBatchingEnabledWhenAdjacentMemoryWritesAreFollowedByReadThenWritesAreMergedAndSentBeforeRead) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableTbxSocketWriteBatching.set(1);
+    CapturingTbxSocketsImp tbxSockets;
+
+    uint8_t data[128];
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = static_cast<uint8_t>(i);
+    }
+
+    EXPECT_TRUE(tbxSockets.writeMemory(0x1000, data, 64, MemType::local));
+    EXPECT_TRUE(tbxSockets.writeMemory(0x1040, data + 64, 64, MemType::local));
+    EXPECT_TRUE(tbxSockets.writeMMIO(0x2000, 1));
+    EXPECT_TRUE(tbxSockets.sentMessages.empty());
+
+    uint32_t value = 0;
+    EXPECT_TRUE(tbxSockets.readMMIO(0x2000, &value));
+    EXPECT_EQ(0x1234u, value);
+    EXPECT_TRUE(tbxSockets.pendingWrites.empty());
+
+    ASSERT_EQ(2u, tbxSockets.sentMessages.size());
+    const auto &batch = tbxSockets.sentMessages[0];
+    constexpr size_t memoryWriteHeaderSize = sizeof(HasHdr) + sizeof(HasWriteDataReq);
+    constexpr size_t mmioWriteSize = sizeof(HasHdr) + sizeof(HasMmioReq);
+    ASSERT_EQ(memoryWriteHeaderSize + sizeof(data) + mmioWriteSize, batch.size());
+
+    HasMsg memoryWrite = {};
+    memcpy(&memoryWrite, batch.data(), memoryWriteHeaderSize);
+    EXPECT_EQ(static_cast<uint32_t>(HAS_WRITE_DATA_REQ_TYPE), memoryWrite.hdr.msgType);
+    EXPECT_EQ(0x1000u, memoryWrite.u.writeReq.address);
+    EXPECT_EQ(sizeof(data), memoryWrite.u.writeReq.size);
+    EXPECT_EQ(0, memcmp(data, batch.data() + memoryWriteHeaderSize, sizeof(data)));
+
+    HasMsg mmioWrite = {};
+    memcpy(&mmioWrite, batch.data() + memoryWriteHeaderSize + sizeof(data), mmioWriteSize);
+    EXPECT_EQ(static_cast<uint32_t>(HAS_MMIO_REQ_TYPE), mmioWrite.hdr.msgType);
+    EXPECT_EQ(1u, mmioWrite.u.mmioReq.write);
+}
+
+TEST(TbxSocketsImpTests, givenWriteBatchingEnabledWhenMemoryWritesAreNotAdjacentThenWritesAreNotMerged) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableTbxSocketWriteBatching.set(1);
+    CapturingTbxSocketsImp tbxSockets;
+
+    uint8_t data[64] = {};
+    EXPECT_TRUE(tbxSockets.writeMemory(0x1000, data, sizeof(data), MemType::local));
+    EXPECT_TRUE(tbxSockets.writeMemory(0x3000, data, sizeof(data), MemType::local));
+    EXPECT_TRUE(tbxSockets.writeMemory(0x3040, data, sizeof(data), MemType::system));
+
+    constexpr size_t memoryWriteHeaderSize = sizeof(HasHdr) + sizeof(HasWriteDataReq);
+    EXPECT_EQ(3 * (memoryWriteHeaderSize + sizeof(data)), tbxSockets.pendingWrites.size());
+    EXPECT_TRUE(tbxSockets.sentMessages.empty());
+}
+
+TEST(TbxSocketsImpTests, givenWriteBatchingDisabledWhenWritingMemoryThenHeaderAndDataAreSentImmediately) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableTbxSocketWriteBatching.set(0);
+    CapturingTbxSocketsImp tbxSockets;
+
+    uint8_t data[64] = {};
+    EXPECT_TRUE(tbxSockets.writeMemory(0x1000, data, sizeof(data), MemType::local));
+    EXPECT_TRUE(tbxSockets.writeMemory(0x1040, data, sizeof(data), MemType::local));
+
+    EXPECT_EQ(4u, tbxSockets.sentMessages.size());
+    EXPECT_TRUE(tbxSockets.pendingWrites.empty());
+}
@@ -270,6 +270,22 @@ TEST(CompilerCacheHashTests, GivenCompilingOptionsWhenGettingCacheThenCorrectCac
     EXPECT_STREQ(hash.c_str(), hash2.c_str());
 }
 
+TEST(CompilerCacheTests, GivenOperationTagWhenComputingHashThenItDiffersFromUntaggedHash) {
+    CompilerCache cache(CompilerCacheConfig{});
+    HardwareInfo hwInfo = *defaultHwInfo;
+    auto src = ArrayRef<const char>("__kernel k() {}");
+    auto apiOptions = ArrayRef<const char>("-cl-opt-disable");
+    auto internalOptions = ArrayRef<const char>("");
+    auto igcRevision = ArrayRef<const char>("0001");
+    size_t igcLibSize = 1000;
+    time_t igcLibMTime = 0;
+
+    std::string buildHash = cache.getCachedFileName(hwInfo, src, apiOptions, internalOptions, ArrayRef<const char>(), ArrayRef<const char>(), igcRevision, igcLibSize, igcLibMTime);
+    std::string linkHash = cache.getCachedFileName(hwInfo, src, apiOptions, internalOptions, ArrayRef<const char>(), ArrayRef<const char>(), igcRevision, igcLibSize, igcLibMTime,
+                                                   ArrayRef<const char>(CompilerCache::linkOperationTag.data(), CompilerCache::linkOperationTag.size()));
+    EXPECT_STRNE(buildHash.c_str(), linkHash.c_str());
+}
+
 TEST(CompilerCacheTests, GivenBinaryCacheWhenDebugFlagIsSetThenTraceFilesAreCreated) {
     DebugManagerStateRestore restorer;
     debugManager.flags.BinaryCacheTrace.set(true);
@@ -437,6 +453,54 @@ TEST(CompilerInterfaceCachedTests, GivenCachedBinaryWhenBuildingThenSuccessIsRet
     gEnvironment->igcPopDebugVars();
 }
 
+TEST(CompilerInterfaceCachedTests, GivenCachedBinaryWhenLinkingThenSuccessIsReturnedWithoutCallingIgc) {
+    TranslationInput inputArgs{IGC::CodeType::elf, IGC::CodeType::oclGenBin};
+
+    auto src = "__kernel k() {}";
+    inputArgs.src = ArrayRef<const char>(src, strlen(src));
+
+    MockCompilerDebugVars igcDebugVars;
+    igcDebugVars.fileName = gEnvironment->igcGetMockFile();
+    igcDebugVars.forceBuildFailure = true;
+    gEnvironment->igcPushDebugVars(igcDebugVars);
+
+    std::unique_ptr<CompilerCacheMock> cache(new CompilerCacheMock());
+    cache->loadResult = true;
+    cache->config.enabled = true;
+    auto compilerInterface = std::unique_ptr<CompilerInterface>(CompilerInterface::createInstance(std::move(cache), true));
+
+    TranslationOutput translationOutput;
+    MockDevice device;
+    auto err = compilerInterface->link(device, inputArgs, translationOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::success, err);
+
+    gEnvironment->igcPopDebugVars();
+}
+
+TEST(CompilerInterfaceCachedTests, GivenDisabledCacheAndCachedBinaryWhenLinkingThenIgcIsCalled) {
+    TranslationInput inputArgs{IGC::CodeType::elf, IGC::CodeType::oclGenBin};
+
+    auto src = "__kernel k() {}";
+    inputArgs.src = ArrayRef<const char>(src, strlen(src));
+
+    MockCompilerDebugVars igcDebugVars;
+    igcDebugVars.fileName = gEnvironment->igcGetMockFile();
+    igcDebugVars.forceBuildFailure = true;
+    gEnvironment->igcPushDebugVars(igcDebugVars);
+
+    std::unique_ptr<CompilerCacheMock> cache(new CompilerCacheMock());
+    cache->loadResult = true;
+    cache->config.enabled = false;
+    auto compilerInterface = std::unique_ptr<CompilerInterface>(CompilerInterface::createInstance(std::move(cache), true));
+
+    TranslationOutput translationOutput;
+    MockDevice device;
+    auto err = compilerInterface->link(device, inputArgs, translationOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::linkFailure, err);
+
+    gEnvironment->igcPopDebugVars();
+}
+
 TEST(CompilerInterfaceCachedTests, givenKernelWithoutIncludesAndBinaryInCacheWhenCompilationRequestedThenFCLIsNotCalled) {
     MockDevice device{};
     TranslationInput inputArgs{IGC::CodeType::oclC, IGC::CodeType::oclGenBin};
@@ -767,6 +831,70 @@ TEST_F(CompilerInterfaceOclElfCacheTest, GivenBinaryWhenBuildingThenPackBinaryOn
     gEnvironment->fclPopDebugVars();
 }
 
+TEST_F(CompilerInterfaceOclElfCacheTest, GivenIrWhenLinkingThenPackBinaryOnCacheSaveAndUnpackBinaryOnLoadFromCache) {
+    gEnvironment->igcPushDebugVars(igcDebugVarsDeviceBinary);
+
+    TranslationInput inputArgs{IGC::CodeType::elf, IGC::CodeType::oclGenBin};
+
+    auto src = "__kernel k() {}";
+    inputArgs.src = ArrayRef<const char>(src, strlen(src));
+
+    TranslationOutput outputFromLinking;
+    MockDevice device;
+    auto err = compilerInterface->link(device, inputArgs, outputFromLinking);
+    EXPECT_EQ(TranslationOutput::ErrorCode::success, err);
+    EXPECT_EQ(0, memcmp(patchtokensProgram.storage.data(), outputFromLinking.deviceBinary.mem.get(), outputFromLinking.deviceBinary.size));
+
+    EXPECT_EQ(1u, mockCompilerCache->cacheInvoked);
+    EXPECT_EQ(1u, mockCompilerCache->hashToBinaryMap.size());
+    EXPECT_TRUE(isPackedOclElf(mockCompilerCache->hashToBinaryMap.begin()->second));
+
+    gEnvironment->igcPopDebugVars();
+
+    // we force igc to fail link request
+    // at the end we expect success which means linking ends in cache
+    gEnvironment->igcPushDebugVars(igcFclDebugVarsForceBuildFailure);
+
+    TranslationOutput outputFromCache;
+    err = compilerInterface->link(device, inputArgs, outputFromCache);
+    EXPECT_EQ(TranslationOutput::ErrorCode::success, err);
+    EXPECT_EQ(1u, mockCompilerCache->cacheInvoked);
+
+    EXPECT_EQ(0, memcmp(patchtokensProgram.storage.data(), outputFromCache.deviceBinary.mem.get(), outputFromCache.deviceBinary.size));
+    EXPECT_EQ(nullptr, outputFromCache.debugData.mem.get());
+
+    gEnvironment->igcPopDebugVars();
+}
+
+TEST_F(CompilerInterfaceOclElfCacheTest, GivenBinaryBuiltFromSameInputsWhenLinkingThenBuildOutputIsNotLoadedFromCache) {
+    gEnvironment->igcPushDebugVars(igcDebugVarsDeviceBinary);
+
+    auto src = "__kernel k() {}";
+    TranslationInput buildArgs{IGC::CodeType::oclC, IGC::CodeType::oclGenBin};
+    buildArgs.src = ArrayRef<const char>(src, strlen(src));
+
+    TranslationOutput outputFromCompilation;
+    MockDevice device;
+    auto err = compilerInterface->build(device, buildArgs, outputFromCompilation);
+    EXPECT_EQ(TranslationOutput::ErrorCode::success, err);
+    EXPECT_EQ(1u, mockCompilerCache->hashToBinaryMap.size());
+
+    gEnvironment->igcPopDebugVars();
+
+    // link request with the same source and options must not end in the cache entry of the build
+    gEnvironment->igcPushDebugVars(igcFclDebugVarsForceBuildFailure);
+
+    TranslationInput linkArgs{IGC::CodeType::elf, IGC::CodeType::oclGenBin};
+    linkArgs.src = buildArgs.src;
+
+    TranslationOutput outputFromLinking;
+    err = compilerInterface->link(device, linkArgs, outputFromLinking);
+    EXPECT_EQ(TranslationOutput::ErrorCode::linkFailure, err);
+    EXPECT_EQ(nullptr, outputFromLinking.deviceBinary.mem.get());
+
+    gEnvironment->igcPopDebugVars();
+}
+
 TEST_F(CompilerInterfaceOclElfCacheTest, GivenBinaryWhenLoadedCacheDoesNotUnpackCorrectlyThenDoNotEndInCacheAndContinueCompilation) {
     gEnvironment->igcPushDebugVars(igcDebugVarsInvalidDeviceBinary);
 
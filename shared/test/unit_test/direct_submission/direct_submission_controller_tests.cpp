@@ -247,6 +247,141 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerAndDivisorD
     controller.unregisterDirectSubmission(&csr);
 }
 
+TEST(DirectSubmissionIdlePredictorTests, givenIdleGapsWhenGettingBucketIndexThenGapsAreGroupedExponentially) {
+    DirectSubmissionIdlePredictor predictor;
+    predictor.setFirstBucketLimit(std::chrono::microseconds{64});
+    EXPECT_EQ(0u, predictor.getBucketIndex(std::chrono::microseconds{0}));
+    EXPECT_EQ(0u, predictor.getBucketIndex(std::chrono::microseconds{63}));
+    EXPECT_EQ(1u, predictor.getBucketIndex(std::chrono::microseconds{64}));
+    EXPECT_EQ(1u, predictor.getBucketIndex(std::chrono::microseconds{127}));
+    EXPECT_EQ(2u, predictor.getBucketIndex(std::chrono::microseconds{128}));
+    EXPECT_EQ(DirectSubmissionIdlePredictor::bucketsCount - 1, predictor.getBucketIndex(std::chrono::hours{1}));
+
+    EXPECT_EQ(32, predictor.getBucketValue(0u).count());
+    EXPECT_EQ(96, predictor.getBucketValue(1u).count());
+    EXPECT_EQ(192, predictor.getBucketValue(2u).count());
+}
+
+TEST(DirectSubmissionIdlePredictorTests, givenFirstBucketLimitChangedWhenGettingBucketIndexThenGapsAreGroupedByNewLimitAndHistoryIsDropped) {
+    DirectSubmissionIdlePredictor predictor;
+    for (uint32_t i = 0; i < DirectSubmissionIdlePredictor::minSamplesCount; i++) {
+        predictor.recordGap(std::chrono::microseconds{100});
+    }
+    EXPECT_EQ(DirectSubmissionIdlePredictor::minSamplesCount, predictor.getSamplesCount());
+
+    predictor.setFirstBucketLimit(std::chrono::microseconds{5'000});
+    EXPECT_EQ(0u, predictor.getSamplesCount());
+    EXPECT_EQ(0u, predictor.getBucketIndex(std::chrono::microseconds{4'999}));
+    EXPECT_EQ(1u, predictor.getBucketIndex(std::chrono::microseconds{5'000}));
+    EXPECT_EQ(2u, predictor.getBucketIndex(std::chrono::microseconds{10'000}));
+
+    predictor.setFirstBucketLimit(std::chrono::microseconds{0});
+    EXPECT_EQ(1, predictor.getFirstBucketLimit().count());
+}
+
+TEST(DirectSubmissionControllerTests, givenDirectSubmissionRegisteredThenIdlePredictorBucketsAreBasedOnControllerTimeout) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DirectSubmissionControllerTimeout.set(2'000);
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+    executionEnvironment.rootDeviceEnvironments[0]->initOsTime();
+
+    DeviceBitfield deviceBitfield(1);
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+    std::unique_ptr<OsContext> osContext(OsContext::create(nullptr, 0, 0,
+                                                           EngineDescriptorHelper::getDefaultDescriptor({aub_stream::ENGINE_CCS, EngineUsage::regular},
+                                                                                                        PreemptionMode::ThreadGroup, deviceBitfield)));
+    csr.setupContext(*osContext.get());
+
+    DirectSubmissionControllerMock controller;
+    controller.registerDirectSubmission(&csr);
+    EXPECT_EQ(controller.timeout, controller.directSubmissions[&csr].idlePredictor.getFirstBucketLimit());
+    EXPECT_EQ(2'000, controller.directSubmissions[&csr].idlePredictor.getFirstBucketLimit().count());
+
+    controller.unregisterDirectSubmission(&csr);
+}
+
+TEST(DirectSubmissionIdlePredictorTests, givenRecordedGapTraceWhenCheckingIfStopIsPreferredThenRestartCostIsComparedWithExpectedRemainingIdleTime) {
+    const std::chrono::microseconds restartCost{1'000};
+    DirectSubmissionIdlePredictor predictor;
+
+    predictor.recordGap(std::chrono::microseconds{100});
+    predictor.recordGap(std::chrono::microseconds{100});
+    predictor.recordGap(std::chrono::microseconds{100});
+    EXPECT_TRUE(predictor.isStopPreferred(std::chrono::microseconds{0}, restartCost));
+
+    predictor.recordGap(std::chrono::microseconds{100});
+    EXPECT_FALSE(predictor.isStopPreferred(std::chrono::microseconds{0}, restartCost));
+    EXPECT_TRUE(predictor.isStopPreferred(std::chrono::microseconds{200}, restartCost));
+
+    for (uint32_t i = 0; i < 4; i++) {
+        predictor.recordGap(std::chrono::milliseconds{10});
+    }
+    EXPECT_TRUE(predictor.isStopPreferred(std::chrono::microseconds{0}, restartCost));
+    EXPECT_TRUE(predictor.isStopPreferred(std::chrono::microseconds{0}, std::chrono::microseconds{5'000}));
+    EXPECT_FALSE(predictor.isStopPreferred(std::chrono::microseconds{0}, std::chrono::microseconds{10'000}));
+}
+
+TEST(DirectSubmissionIdlePredictorTests, givenManyGapsRecordedWhenDecayThresholdReachedThenOldHistoryIsAgedOut) {
+    DirectSubmissionIdlePredictor predictor;
+    for (uint32_t i = 0; i < DirectSubmissionIdlePredictor::decaySamplesCount - 1; i++) {
+        predictor.recordGap(std::chrono::milliseconds{10});
+    }
+    EXPECT_EQ(DirectSubmissionIdlePredictor::decaySamplesCount - 1, predictor.getSamplesCount());
+
+    predictor.recordGap(std::chrono::microseconds{100});
+    EXPECT_EQ(DirectSubmissionIdlePredictor::decaySamplesCount / 2 - 1, predictor.getSamplesCount());
+}
+
+TEST(DirectSubmissionControllerTests, givenIdlePredictionEnabledWhenShortGapsAreRecordedThenRingIsKeptRunningUntilPredictedIdleExceedsRestartCost) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DirectSubmissionControllerIdlePredictionRestartCost.set(1'000);
+    debugManager.flags.DirectSubmissionControllerTimeout.set(100);
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+    executionEnvironment.rootDeviceEnvironments[0]->initOsTime();
+
+    DeviceBitfield deviceBitfield(1);
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+    std::unique_ptr<OsContext> osContext(OsContext::create(nullptr, 0, 0,
+                                                           EngineDescriptorHelper::getDefaultDescriptor({aub_stream::ENGINE_CCS, EngineUsage::regular},
+                                                                                                        PreemptionMode::ThreadGroup, deviceBitfield)));
+    csr.setupContext(*osContext.get());
+
+    DirectSubmissionControllerMock controller;
+    controller.timeoutElapsedReturnValue.store(TimeoutElapsedMode::fullyElapsed);
+    controller.registerDirectSubmission(&csr);
+
+    auto &state = controller.directSubmissions[&csr];
+    TaskCountType taskCount = 0u;
+    for (uint32_t i = 0; i < DirectSubmissionIdlePredictor::minSamplesCount; i++) {
+        csr.taskCount.store(++taskCount);
+        controller.checkNewSubmissions();
+        EXPECT_FALSE(state.isStopped);
+
+        controller.cpuTimestamp += std::chrono::microseconds(100);
+        controller.checkNewSubmissions();
+        EXPECT_TRUE(state.isStopped);
+        controller.cpuTimestamp += std::chrono::microseconds(100);
+    }
+    csr.taskCount.store(++taskCount);
+    controller.checkNewSubmissions();
+    EXPECT_EQ(DirectSubmissionIdlePredictor::minSamplesCount, state.idlePredictor.getSamplesCount());
+
+    controller.cpuTimestamp += std::chrono::microseconds(100);
+    controller.checkNewSubmissions();
+    EXPECT_FALSE(state.isStopped);
+    EXPECT_TRUE(state.idleObserved);
+
+    controller.cpuTimestamp += std::chrono::microseconds(5'000);
+    controller.checkNewSubmissions();
+    EXPECT_TRUE(state.isStopped);
+
+    controller.unregisterDirectSubmission(&csr);
+}
+
 void fillTimeoutParamsMap(DirectSubmissionControllerMock &controller) {
     controller.timeoutParamsMap.clear();
     for (auto throttle : {QueueThrottle::LOW, QueueThrottle::MEDIUM, QueueThrottle::HIGH}) {
@@ -9,6 +9,7 @@
 #include "shared/source/command_stream/submissions_aggregator.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/direct_submission/direct_submission_hw.h"
+#include "shared/source/direct_submission/direct_submission_latency_stats.h"
 #include "shared/source/direct_submission/dispatchers/render_dispatcher.h"
 #include "shared/source/direct_submission/relaxed_ordering_helper.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
@@ -323,6 +324,52 @@ HWTEST_F(DirectSubmissionDispatchBufferTest, givenCopyCommandBufferIntoRingWhenD
     EXPECT_EQ(nullptr, bbStart);
 }
 
+HWTEST_F(DirectSubmissionDispatchBufferTest, givenLatencyStatsEnabledWhenDispatchCommandBufferThenPhasesAreRecordedAndPrintedOnDestruction) {
+    using Dispatcher = RenderDispatcher<FamilyType>;
+
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DirectSubmissionPrintLatencyStats.set(1);
+
+    testing::internal::CaptureStdout();
+    {
+        FlushStampTracker flushStamp(true);
+        MockDirectSubmissionHw<FamilyType, Dispatcher> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+        auto latencyStats = directSubmission.getLatencyStats();
+        ASSERT_NE(nullptr, latencyStats);
+
+        EXPECT_TRUE(directSubmission.initialize(true));
+        EXPECT_EQ(0u, latencyStats->getPhaseStats(DirectSubmissionPhase::dispatchCommandBuffer).samples);
+
+        batchBuffer.endCmdPtr = batchBuffer.stream->getCpuBase();
+        EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+        EXPECT_EQ(1u, latencyStats->getPhaseStats(DirectSubmissionPhase::dispatchCommandBuffer).samples);
+        EXPECT_EQ(1u, latencyStats->getPhaseStats(DirectSubmissionPhase::unblockGpu).samples);
+    }
+    auto output = testing::internal::GetCapturedStdout();
+    EXPECT_NE(std::string::npos, output.find("dispatchCommandBuffer: samples 1"));
+}
+
+HWTEST_F(DirectSubmissionDispatchBufferTest, givenLatencyStatsDisabledWhenCreatingDirectSubmissionThenStatsAreNotCollected) {
+    using Dispatcher = RenderDispatcher<FamilyType>;
+
+    MockDirectSubmissionHw<FamilyType, Dispatcher> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+    EXPECT_EQ(nullptr, directSubmission.getLatencyStats());
+}
+
+TEST(DirectSubmissionPhaseStatsTest, whenRecordingSamplesThenTotalsMaxAndLog2HistogramAreUpdated) {
+    DirectSubmissionPhaseStats phaseStats;
+    phaseStats.record(0u);
+    phaseStats.record(1u);
+    phaseStats.record(5u);
+    phaseStats.record(std::numeric_limits<uint64_t>::max());
+
+    EXPECT_EQ(4u, phaseStats.samples);
+    EXPECT_EQ(std::numeric_limits<uint64_t>::max(), phaseStats.maxTicks);
+    EXPECT_EQ(2u, phaseStats.histogram[0]);
+    EXPECT_EQ(1u, phaseStats.histogram[2]);
+    EXPECT_EQ(1u, phaseStats.histogram[DirectSubmissionPhaseStats::histogramBuckets - 1]);
+}
+
 HWTEST_F(DirectSubmissionDispatchBufferTest, givenDefaultDirectSubmissionFlatRingBufferAndSingleTileDirectSubmissionWhenSubmitSystemMemNotChainedBatchBufferWithoutRelaxingDependenciesThenCopyIntoRing) {
     using Dispatcher = RenderDispatcher<FamilyType>;
 
@@ -13,6 +13,8 @@
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/helpers/simd_helper.h"
+#include "shared/source/kernel/dispatch_walker_template.h"
+#include "shared/source/kernel/grf_config.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/os_interface/product_helper.h"
 #include "shared/test/common/cmd_parse/gen_cmd_parse.h"
@@ -1699,6 +1701,76 @@ HWTEST2_F(CommandEncodeStatesTest, givenEncodeDispatchKernelWhenRequestingComman
     EXPECT_ANY_THROW(EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs));
 }
 
+HWTEST2_F(CommandEncodeStatesTest, givenDispatchWalkerTemplateWhenEncodingKernelMultipleTimesThenWalkerIsEqualToWalkerEncodedWithoutTemplate, IsAtLeastXeHpCore) {
+    using DefaultWalkerType = typename FamilyType::DefaultWalkerType;
+    uint32_t dims[] = {2, 1, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    dispatchInterface->kernelDescriptor.kernelAttributes.barrierCount = 1;
+    dispatchInterface->kernelDescriptor.kernelAttributes.numGrfRequired = GrfConfig::defaultGrfNumber;
+
+    uint8_t payloadView[256] = {};
+    auto encodeWalker = [&](DefaultWalkerType &walker) {
+        bool requiresUncachedMocs = false;
+        EncodeDispatchKernelArgs dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, requiresUncachedMocs);
+        dispatchArgs.makeCommandView = true;
+        dispatchArgs.cpuPayloadBuffer = payloadView;
+        dispatchArgs.cpuWalkerBuffer = &walker;
+        EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+    };
+
+    DefaultWalkerType walkerWithoutTemplate = {};
+    encodeWalker(walkerWithoutTemplate);
+
+    DispatchWalkerTemplate walkerTemplate;
+    dispatchInterface->dispatchWalkerTemplate = &walkerTemplate;
+
+    DefaultWalkerType walkerStoringTemplate = {};
+    encodeWalker(walkerStoringTemplate);
+    EXPECT_TRUE(walkerTemplate.isValid());
+
+    DefaultWalkerType walkerLoadedFromTemplate = {};
+    encodeWalker(walkerLoadedFromTemplate);
+
+    EXPECT_EQ(0, memcmp(&walkerWithoutTemplate, &walkerStoringTemplate, sizeof(DefaultWalkerType)));
+    EXPECT_EQ(0, memcmp(&walkerWithoutTemplate, &walkerLoadedFromTemplate, sizeof(DefaultWalkerType)));
+}
+
+HWTEST2_F(CommandEncodeStatesTest, givenDispatchWalkerTemplateStoredForDifferentKernelThreadArbitrationPolicyWhenEncodingKernelThenWalkerIsEncodedWithoutTemplate, IsAtLeastXeHpCore) {
+    using DefaultWalkerType = typename FamilyType::DefaultWalkerType;
+    uint32_t dims[] = {2, 1, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    dispatchInterface->kernelDescriptor.kernelAttributes.barrierCount = 1;
+
+    uint8_t payloadView[256] = {};
+    auto encodeWalker = [&](DefaultWalkerType &walker) {
+        bool requiresUncachedMocs = false;
+        EncodeDispatchKernelArgs dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, requiresUncachedMocs);
+        dispatchArgs.makeCommandView = true;
+        dispatchArgs.cpuPayloadBuffer = payloadView;
+        dispatchArgs.cpuWalkerBuffer = &walker;
+        EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+    };
+
+    DispatchWalkerTemplate walkerTemplate;
+    dispatchInterface->dispatchWalkerTemplate = &walkerTemplate;
+
+    DefaultWalkerType walkerStoringTemplate = {};
+    encodeWalker(walkerStoringTemplate);
+    EXPECT_TRUE(walkerTemplate.isValid());
+
+    dispatchInterface->kernelDescriptor.kernelAttributes.threadArbitrationPolicy = ThreadArbitrationPolicy::RoundRobin;
+    dispatchInterface->kernelDescriptor.kernelAttributes.barrierCount = 0;
+
+    DefaultWalkerType walkerWithTemplate = {};
+    encodeWalker(walkerWithTemplate);
+
+    dispatchInterface->dispatchWalkerTemplate = nullptr;
+    DefaultWalkerType walkerWithoutTemplate = {};
+    encodeWalker(walkerWithoutTemplate);
+
+    EXPECT_EQ(0, memcmp(&walkerWithoutTemplate, &walkerWithTemplate, sizeof(DefaultWalkerType)));
+}
+
 struct MultiTileCommandEncodeStatesFixture : public CommandEncodeStatesFixture {
     void setUp() {
         debugManager.flags.CreateMultipleSubDevices.set(2);
@@ -914,6 +914,64 @@ HWCMDTEST_F(IGFX_XE_HP_CORE, WalkerPartitionTests, givenStaticPartitioningWhenZD
     EXPECT_EQ(WalkerType::PARTITION_TYPE::PARTITION_TYPE_Z, walker.getPartitionType());
 }
 
+HWCMDTEST_F(IGFX_XE_HP_CORE, WalkerPartitionTests, givenSelectDimensionByImbalanceEnabledWhenDeepestDimensionLeavesTilesIdleThenLessImbalancedDimensionIsSelected) {
+    using WalkerType = typename FamilyType::DefaultWalkerType;
+    DebugManagerStateRestore restore{};
+    WalkerType walker;
+    walker = FamilyType::template getInitGpuWalker<WalkerType>();
+    walker.setThreadGroupIdXDimension(1000u);
+    walker.setThreadGroupIdYDimension(1000u);
+    walker.setThreadGroupIdZDimension(21u);
+
+    bool staticPartitioning = false;
+    auto partitionCount = computePartitionCountAndSetPartitionType<FamilyType>(&walker, NEO::RequiredPartitionDim::none, 4u, true, &staticPartitioning);
+    EXPECT_TRUE(staticPartitioning);
+    EXPECT_EQ(4u, partitionCount);
+    EXPECT_EQ(WalkerType::PARTITION_TYPE::PARTITION_TYPE_Z, walker.getPartitionType());
+
+    debugManager.flags.WalkerPartitionSelectDimensionByImbalance.set(1);
+
+    partitionCount = computePartitionCountAndSetPartitionType<FamilyType>(&walker, NEO::RequiredPartitionDim::none, 4u, true, &staticPartitioning);
+    EXPECT_TRUE(staticPartitioning);
+    EXPECT_EQ(4u, partitionCount);
+    EXPECT_EQ(WalkerType::PARTITION_TYPE::PARTITION_TYPE_Y, walker.getPartitionType());
+
+    partitionCount = computePartitionCountAndSetPartitionType<FamilyType>(&walker, NEO::RequiredPartitionDim::x, 4u, true, &staticPartitioning);
+    EXPECT_EQ(4u, partitionCount);
+    EXPECT_EQ(WalkerType::PARTITION_TYPE::PARTITION_TYPE_X, walker.getPartitionType());
+}
+
+HWCMDTEST_F(IGFX_XE_HP_CORE, WalkerPartitionTests, givenEqualImbalanceInMultipleDimensionsWhenSelectingPartitionTypeThenDeeperDimensionIsSelected) {
+    using WalkerType = typename FamilyType::DefaultWalkerType;
+    size_t workgroupCount = 0u;
+
+    EXPECT_EQ(WalkerType::PARTITION_TYPE::PARTITION_TYPE_Y, selectPartitionTypeWithLowestImbalance<WalkerType>(4u, {8u, 8u, 1u}, &workgroupCount));
+    EXPECT_EQ(8u, workgroupCount);
+
+    EXPECT_EQ(WalkerType::PARTITION_TYPE::PARTITION_TYPE_X, selectPartitionTypeWithLowestImbalance<WalkerType>(4u, {16u, 6u, 3u}, &workgroupCount));
+    EXPECT_EQ(16u, workgroupCount);
+
+    EXPECT_EQ(WalkerType::PARTITION_TYPE::PARTITION_TYPE_X, selectPartitionTypeWithLowestImbalance<WalkerType>(4u, {1u, 1u, 1u}, &workgroupCount));
+    EXPECT_EQ(1u, workgroupCount);
+}
+
+HWCMDTEST_F(IGFX_XE_HP_CORE, WalkerPartitionTests, givenSelectDimensionByImbalanceEnabledAndDynamicPartitioningWhenSingleWorkgroupIsDispatchedThenPartitioningIsDisabled) {
+    using WalkerType = typename FamilyType::DefaultWalkerType;
+    DebugManagerStateRestore restore{};
+    debugManager.flags.WalkerPartitionSelectDimensionByImbalance.set(1);
+    WalkerType walker;
+    walker = FamilyType::template getInitGpuWalker<WalkerType>();
+    walker.setThreadGroupIdXDimension(1u);
+    walker.setThreadGroupIdYDimension(1u);
+    walker.setThreadGroupIdZDimension(1u);
+
+    bool staticPartitioning = true;
+    auto partitionCount = computePartitionCountAndSetPartitionType<FamilyType>(&walker, NEO::RequiredPartitionDim::none, 2u, false, &staticPartitioning);
+    EXPECT_FALSE(staticPartitioning);
+    EXPECT_EQ(1u, partitionCount);
+    EXPECT_EQ(WalkerType::PARTITION_TYPE::PARTITION_TYPE_DISABLED, walker.getPartitionType());
+}
+
 HWCMDTEST_F(IGFX_XE_HP_CORE, WalkerPartitionTests, givenSelfCleanupSectionWhenDebugForceDisableCrossTileSyncThenSelfCleanupOverridesDebugAndAddsOwnCleanupSection) {
     using WalkerType = typename FamilyType::DefaultWalkerType;
     using PostSyncType = decltype(FamilyType::template getPostSyncType<WalkerType>());
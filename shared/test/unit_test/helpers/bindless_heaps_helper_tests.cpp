@@ -106,6 +106,65 @@ TEST_F(BindlessHeapsHelperTests, givenNoMemoryAvailableWhenAllocateSsInHeapThenN
     EXPECT_EQ(nullptr, info.heapAllocation);
 }
 
+TEST_F(BindlessHeapsHelperTests, givenNoMemoryAvailableAndReleasedSlotWhenAllocateSsInHeapThenReleasedSlotIsReusedAndStateCacheIsInvalidated) {
+    auto bindlessHeapHelper = std::make_unique<MockBindlesHeapsHelper>(getDevice(), false);
+    size_t size = bindlessHeapHelper->surfaceStateSize;
+
+    auto ssInHeapInfo = bindlessHeapHelper->allocateSSInHeap(size, nullptr, BindlessHeapsHelper::BindlesHeapType::globalSsh);
+    ASSERT_NE(nullptr, ssInHeapInfo.ssPtr);
+    bindlessHeapHelper->releaseSSToReusePool(ssInHeapInfo);
+    EXPECT_FALSE(bindlessHeapHelper->allocateFromReusePool);
+
+    bindlessHeapHelper->globalSsh->getSpace(bindlessHeapHelper->globalSsh->getAvailableSpace());
+    memManager->failAllocateSystemMemory = true;
+    memManager->failAllocate32Bit = true;
+
+    auto reusedInfo = bindlessHeapHelper->allocateSSInHeap(size, nullptr, BindlessHeapsHelper::BindlesHeapType::globalSsh);
+    EXPECT_EQ(ssInHeapInfo.ssPtr, reusedInfo.ssPtr);
+    EXPECT_EQ(ssInHeapInfo.surfaceStateOffset, reusedInfo.surfaceStateOffset);
+    EXPECT_EQ(std::numeric_limits<uint64_t>::max(), bindlessHeapHelper->stateCacheDirtyForContext.to_ullong());
+    EXPECT_FALSE(bindlessHeapHelper->allocateFromReusePool);
+
+    auto info = bindlessHeapHelper->allocateSSInHeap(size, nullptr, BindlessHeapsHelper::BindlesHeapType::globalSsh);
+    EXPECT_EQ(nullptr, info.ssPtr);
+    EXPECT_EQ(nullptr, info.heapAllocation);
+}
+
+TEST_F(BindlessHeapsHelperTests, givenNoMemoryAvailableWhenOtherSizeIsRequestedFromReusePoolThenReleasedSlotsAreRecycled) {
+    auto bindlessHeapHelper = std::make_unique<MockBindlesHeapsHelper>(getDevice(), false);
+    bindlessHeapHelper->reuseSlotCountThreshold = 1;
+    size_t size = bindlessHeapHelper->surfaceStateSize;
+
+    SurfaceStateInHeapInfo ssInHeapInfos[3];
+    ssInHeapInfos[0] = bindlessHeapHelper->allocateSSInHeap(size, nullptr, BindlessHeapsHelper::BindlesHeapType::globalSsh);
+    ssInHeapInfos[1] = bindlessHeapHelper->allocateSSInHeap(size, nullptr, BindlessHeapsHelper::BindlesHeapType::globalSsh);
+    ssInHeapInfos[2] = bindlessHeapHelper->allocateSSInHeap(NEO::BindlessImageSlot::max * size, nullptr, BindlessHeapsHelper::BindlesHeapType::globalSsh);
+    bindlessHeapHelper->releaseSSToReusePool(ssInHeapInfos[0]);
+    bindlessHeapHelper->releaseSSToReusePool(ssInHeapInfos[1]);
+
+    auto reusedInfo = bindlessHeapHelper->allocateSSInHeap(size, nullptr, BindlessHeapsHelper::BindlesHeapType::globalSsh);
+    EXPECT_EQ(ssInHeapInfos[1].ssPtr, reusedInfo.ssPtr);
+    EXPECT_TRUE(bindlessHeapHelper->allocateFromReusePool);
+    EXPECT_EQ(1u, bindlessHeapHelper->releasePoolIndex);
+
+    bindlessHeapHelper->releaseSSToReusePool(ssInHeapInfos[2]);
+    bindlessHeapHelper->stateCacheDirtyForContext.reset();
+
+    bindlessHeapHelper->globalSsh->getSpace(bindlessHeapHelper->globalSsh->getAvailableSpace());
+    memManager->failAllocateSystemMemory = true;
+    memManager->failAllocate32Bit = true;
+
+    reusedInfo = bindlessHeapHelper->allocateSSInHeap(NEO::BindlessImageSlot::max * size, nullptr, BindlessHeapsHelper::BindlesHeapType::globalSsh);
+    EXPECT_EQ(ssInHeapInfos[2].ssPtr, reusedInfo.ssPtr);
+    EXPECT_EQ(std::numeric_limits<uint64_t>::max(), bindlessHeapHelper->stateCacheDirtyForContext.to_ullong());
+    EXPECT_EQ(1u, bindlessHeapHelper->allocatePoolIndex);
+    EXPECT_EQ(0u, bindlessHeapHelper->releasePoolIndex);
+    EXPECT_EQ(1u, bindlessHeapHelper->surfaceStateInHeapVectorReuse[bindlessHeapHelper->releasePoolIndex][0].size());
+
+    reusedInfo = bindlessHeapHelper->allocateSSInHeap(size, nullptr, BindlessHeapsHelper::BindlesHeapType::globalSsh);
+    EXPECT_EQ(ssInHeapInfos[0].ssPtr, reusedInfo.ssPtr);
+}
+
 TEST_F(BindlessHeapsHelperTests, givenNoMemoryAvailableWhenAllocatingBindlessSlotThenFalseIsReturned) {
     auto bindlessHeapHelper = std::make_unique<MockBindlesHeapsHelper>(getDevice(), false);
     auto bindlessHeapHelperPtr = bindlessHeapHelper.get();
@@ -552,6 +611,17 @@ TEST_F(BindlessHeapsHelperTests, givenBindlessHelperWhenGettingAndClearingDirsty
     EXPECT_FALSE(bindlessHeapHelper->getStateDirtyForContext(3));
 }
 
+TEST_F(BindlessHeapsHelperTests, givenSlotAllocationLockHeldWhenGettingAndClearingDirtyStateForContextThenLockIsNotRequired) {
+    auto bindlessHeapHelper = std::make_unique<MockBindlesHeapsHelper>(getDevice(), false);
+    bindlessHeapHelper->stateCacheDirtyForContext.set();
+
+    std::lock_guard<std::mutex> slotAllocationLock(bindlessHeapHelper->mtx);
+    EXPECT_TRUE(bindlessHeapHelper->getStateDirtyForContext(3));
+    bindlessHeapHelper->clearStateDirtyForContext(3);
+    EXPECT_FALSE(bindlessHeapHelper->getStateDirtyForContext(3));
+    EXPECT_TRUE(bindlessHeapHelper->getStateDirtyForContext(2));
+}
+
 TEST_F(BindlessHeapsHelperTests, givenBindlessHeapHelperWhenItsCreatedThenSshAllocationsAreResident) {
     auto bindlessHeapHelper = std::make_unique<MockBindlesHeapsHelper>(getDevice(), false);
     MemoryOperationsHandler *memoryOperationsIface = getDevice()->getRootDeviceEnvironmentRef().memoryOperationsInterface.get();
@@ -16,6 +16,7 @@
 #include "gtest/gtest.h"
 
 #include <memory>
+#include <vector>
 
 using namespace NEO;
 
@@ -163,7 +164,6 @@ TEST_F(PageTableTests48, WhenAssigningWalkerThenWalkIsExecutedCorrectly) {
     size_t lastOffset = 0;
     PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
         EXPECT_EQ(lastOffset, offset);
-        EXPECT_GE(pageSize, size);
 
         walked += size;
         lastOffset += size;
@@ -172,6 +172,48 @@ TEST_F(PageTableTests48, WhenAssigningWalkerThenWalkIsExecutedCorrectly) {
     EXPECT_EQ(lSize, walked);
 }
 
+TEST_F(PageTableTests48, givenPhysicallyContiguousPagesWhenPageWalkIsCalledThenSingleRunPerPageTableIsReported) {
+    std::unique_ptr<PPGTTPageTable> pageTable(new PPGTTPageTable(&allocator));
+    uintptr_t gpuVa = refAddr + (510 * pageSize) + 0x10;
+    size_t size = 8 * pageSize;
+    auto expectedPhysAddress = allocator.mainAllocator.load() + 0x10;
+
+    std::vector<std::pair<uint64_t, size_t>> runs;
+    PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+        runs.push_back({physAddress, size});
+    };
+    pageTable->pageWalk(gpuVa, size, 0, 0, walker, MemoryBanks::mainBank);
+
+    ASSERT_EQ(2u, runs.size());
+    EXPECT_EQ(expectedPhysAddress, runs[0].first);
+    EXPECT_EQ(2 * pageSize - 0x10, runs[0].second);
+    EXPECT_EQ(runs[0].first + runs[0].second, runs[1].first);
+    EXPECT_EQ(size - runs[0].second, runs[1].second);
+}
+
+TEST_F(PageTableTests48, givenPagesWithDifferentEntryBitsWhenPageWalkIsCalledThenRunIsSplitOnEntryBitsChange) {
+    std::unique_ptr<PPGTTPageTable> pageTable(new PPGTTPageTable(&allocator));
+    uintptr_t gpuVa = refAddr;
+
+    PageWalker dummyWalker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {};
+    pageTable->pageWalk(gpuVa, 4 * pageSize, 0, 0, dummyWalker, MemoryBanks::mainBank);
+    pageTable->pageWalk(gpuVa + 2 * pageSize, pageSize, 0, 0x2, dummyWalker, MemoryBanks::mainBank);
+
+    std::vector<std::pair<size_t, size_t>> runs;
+    PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+        runs.push_back({offset, size});
+    };
+    pageTable->pageWalk(gpuVa, 4 * pageSize, 0, PageTableEntry::nonValidBits, walker, MemoryBanks::mainBank);
+
+    ASSERT_EQ(3u, runs.size());
+    EXPECT_EQ(0u, runs[0].first);
+    EXPECT_EQ(2 * pageSize, runs[0].second);
+    EXPECT_EQ(2 * pageSize, runs[1].first);
+    EXPECT_EQ(pageSize, runs[1].second);
+    EXPECT_EQ(3 * pageSize, runs[2].first);
+    EXPECT_EQ(pageSize, runs[2].second);
+}
+
 TEST_F(PageTableTests48, givenReservedPhysicalAddressWhenPageWalkIsCalledThenPageTablesAreFilledWithProperAddresses) {
     if constexpr (is64bit) {
         std::unique_ptr<MockPML4> pageTable(std::make_unique<MockPML4>(&allocator));
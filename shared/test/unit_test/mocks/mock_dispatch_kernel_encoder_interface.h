@@ -34,6 +34,8 @@ struct MockDispatchKernelEncoder : public DispatchKernelEncoderI {
         samplerStateOffsetPassed = samplerStateOffset;
     }
 
+    DispatchWalkerTemplate *getDispatchWalkerTemplate() const override { return dispatchWalkerTemplate; }
+
     MockGraphicsAllocation mockAllocation{};
     static constexpr uint32_t crossThreadSize = 0x40;
     static constexpr uint32_t perThreadSize = 0x20;
@@ -44,6 +46,7 @@ struct MockDispatchKernelEncoder : public DispatchKernelEncoderI {
     KernelDescriptor kernelDescriptor{};
 
     mutable uint64_t samplerStateOffsetPassed = 0u;
+    DispatchWalkerTemplate *dispatchWalkerTemplate = nullptr;
 
     ADDMETHOD_CONST_NOBASE(getKernelDescriptor, const KernelDescriptor &, kernelDescriptor, ());
     ADDMETHOD_CONST_NOBASE(getGroupSize, const uint32_t *, groupSizes, ());
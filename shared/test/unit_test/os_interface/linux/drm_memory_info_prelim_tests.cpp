@@ -19,6 +19,8 @@
 
 #include "gtest/gtest.h"
 
+#include <linux/mempolicy.h>
+
 using namespace NEO;
 
 TEST(MemoryInfoPrelim, givenMemoryRegionQueryNotSupportedWhenQueryingMemoryInfoThenMemoryInfoIsNotCreated) {
@@ -607,6 +609,71 @@ TEST(MemoryInfo, givenMemoryInfoWithMemoryPolicyEnabledWhenCallingCreateGemExtFo
     WhiteBoxNumaLibrary::osLibrary.reset();
 }
 
+TEST(MemoryInfo, givenMemoryInfoWithMemoryPolicyEnabledAndDeviceNumaNodeWhenCallingCreateGemExtForHostAllocationThenIoctlIsCalledWithDeviceLocalNode) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableHostAllocationMemPolicy.set(1);
+    debugManager.flags.OverrideHostAllocationMemPolicyMode.set(-1);
+    std::vector<MemoryRegion> regionInfo(2);
+    regionInfo[0].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_SYSTEM, 0};
+    regionInfo[0].probedSize = 8 * MemoryConstants::gigaByte;
+    regionInfo[1].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_DEVICE, 0};
+    regionInfo[1].probedSize = 16 * MemoryConstants::gigaByte;
+
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    auto drm = std::make_unique<DrmQueryMock>(*executionEnvironment->rootDeviceEnvironments[0]);
+
+    constexpr static int numNuma = 4;
+    // setup numa library in MemoryInfo
+    WhiteBoxNumaLibrary::GetMemPolicyPtr memPolicyHandler =
+        [](int *, unsigned long[], unsigned long, void *, unsigned long) -> long { return -1; };
+    WhiteBoxNumaLibrary::NumaAvailablePtr numaAvailableHandler =
+        [](void) -> int { return 0; };
+    WhiteBoxNumaLibrary::NumaMaxNodePtr numaMaxNodeHandler =
+        [](void) -> int { return numNuma - 1; };
+    MockOsLibrary::loadLibraryNewObject = new MockOsLibraryCustom(nullptr, true);
+    MockOsLibraryCustom *osLibrary = static_cast<MockOsLibraryCustom *>(MockOsLibrary::loadLibraryNewObject);
+    // register proc pointers
+    osLibrary->procMap[std::string(WhiteBoxNumaLibrary::procGetMemPolicyStr)] = reinterpret_cast<void *>(memPolicyHandler);
+    osLibrary->procMap[std::string(WhiteBoxNumaLibrary::procNumaAvailableStr)] = reinterpret_cast<void *>(numaAvailableHandler);
+    osLibrary->procMap[std::string(WhiteBoxNumaLibrary::procNumaMaxNodeStr)] = reinterpret_cast<void *>(numaMaxNodeHandler);
+
+    VariableBackup<decltype(NEO::OsLibrary::loadFunc)> funcBackup{&NEO::OsLibrary::loadFunc, MockOsLibraryCustom::load};
+
+    auto memoryInfo = std::make_unique<MemoryInfo>(regionInfo, *drm);
+    ASSERT_NE(nullptr, memoryInfo);
+    ASSERT_TRUE(memoryInfo->isMemPolicySupported());
+    memoryInfo->setDeviceNumaNode(2);
+
+    uint32_t handle = 0;
+    MemRegionsVec memClassInstance = {regionInfo[0].region, regionInfo[1].region};
+    uint32_t numOfChunks = 0;
+    auto ret = memoryInfo->createGemExt(memClassInstance, 1024, handle, 0, {}, -1, false, numOfChunks, true);
+    EXPECT_EQ(0, ret);
+    ASSERT_TRUE(drm->context.receivedCreateGemExt);
+    EXPECT_EQ(static_cast<uint32_t>(MPOL_PREFERRED), drm->context.receivedCreateGemExt->memPolicyExt.mode);
+    auto &nodeMask = drm->context.receivedCreateGemExt->memPolicyExt.nodeMask.value();
+    ASSERT_EQ(static_cast<size_t>(numNuma), nodeMask.size());
+    EXPECT_EQ(1ul << 2, nodeMask[0]);
+    EXPECT_EQ(1u, memoryInfo->getNumaPlacedHostAllocationsCount());
+
+    debugManager.flags.OverrideHostAllocationMemPolicyNode.set(1);
+    ret = memoryInfo->createGemExt(memClassInstance, 1024, handle, 0, {}, -1, false, numOfChunks, true);
+    EXPECT_EQ(0, ret);
+    EXPECT_EQ(1ul << 1, drm->context.receivedCreateGemExt->memPolicyExt.nodeMask.value()[0]);
+    EXPECT_EQ(2u, memoryInfo->getNumaPlacedHostAllocationsCount());
+
+    debugManager.flags.OverrideHostAllocationMemPolicyNode.set(numNuma);
+    drm->context.receivedCreateGemExt.reset();
+    ret = memoryInfo->createGemExt(memClassInstance, 1024, handle, 0, {}, -1, false, numOfChunks, true);
+    EXPECT_EQ(0, ret);
+    ASSERT_TRUE(drm->context.receivedCreateGemExt);
+    EXPECT_EQ(std::nullopt, drm->context.receivedCreateGemExt->memPolicyExt.mode);
+    EXPECT_EQ(2u, memoryInfo->getNumaPlacedHostAllocationsCount());
+
+    MockOsLibrary::loadLibraryNewObject = nullptr;
+    WhiteBoxNumaLibrary::osLibrary.reset();
+}
+
 TEST(MemoryInfo, givenMemoryInfoWithMemoryPolicyEnabledAndOverrideMemoryPolicyModeWhenCallingCreateGemExtForHostAllocationThenIoctlIsCalledWithMemoryPolicy) {
     DebugManagerStateRestore restorer;
     debugManager.flags.EnableHostAllocationMemPolicy.set(1);
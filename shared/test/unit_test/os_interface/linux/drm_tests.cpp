@@ -248,6 +248,83 @@ TEST(DrmTest, givenSysfsNodeReadFailsWithImproperDataWhenGetDeviceMemoryPhysical
     EXPECT_FALSE(drm.getDeviceMemoryPhysicalSizeInBytes(0, size));
 }
 
+TEST(DrmTest, GivenValidNumaNodeSysfsEntryWhenGetDeviceNumaNodeIsCalledThenNodeIsReturned) {
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    DrmMock drm{*executionEnvironment->rootDeviceEnvironments[0]};
+
+    drm.setPciPath("device");
+    VariableBackup<decltype(SysCalls::sysCallsOpen)> mockOpen(&SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int {
+        return std::string(pathname) == getLinuxDevicesPath("device/numa_node") ? 1 : -1;
+    });
+
+    VariableBackup<decltype(SysCalls::sysCallsPread)> mockPread(&SysCalls::sysCallsPread, [](int fd, void *buf, size_t count, off_t offset) -> ssize_t {
+        const std::string testData("1\n");
+        memcpy(buf, testData.data(), testData.length());
+        return testData.length();
+    });
+    EXPECT_EQ(1, drm.getDeviceNumaNode());
+}
+
+TEST(DrmTest, GivenNoNumaNodeAssignedInSysfsWhenGetDeviceNumaNodeIsCalledThenMinusOneIsReturned) {
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    DrmMock drm{*executionEnvironment->rootDeviceEnvironments[0]};
+
+    drm.setPciPath("device");
+    VariableBackup<decltype(SysCalls::sysCallsOpen)> mockOpen(&SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int {
+        return 1;
+    });
+
+    VariableBackup<decltype(SysCalls::sysCallsPread)> mockPread(&SysCalls::sysCallsPread, [](int fd, void *buf, size_t count, off_t offset) -> ssize_t {
+        const std::string testData("-1\n");
+        memcpy(buf, testData.data(), testData.length());
+        return testData.length();
+    });
+    EXPECT_EQ(-1, drm.getDeviceNumaNode());
+}
+
+TEST(DrmTest, GivenMissingNumaNodeSysfsEntryWhenGetDeviceNumaNodeIsCalledThenMinusOneIsReturned) {
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    DrmMock drm{*executionEnvironment->rootDeviceEnvironments[0]};
+
+    drm.setPciPath("device");
+    VariableBackup<decltype(SysCalls::sysCallsOpen)> mockOpen(&SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int {
+        return -1;
+    });
+    EXPECT_EQ(-1, drm.getDeviceNumaNode());
+}
+
+TEST(DrmTest, GivenNumaNodeSysfsReadFailsWhenGetDeviceNumaNodeIsCalledThenMinusOneIsReturned) {
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    DrmMock drm{*executionEnvironment->rootDeviceEnvironments[0]};
+
+    drm.setPciPath("device");
+    VariableBackup<decltype(SysCalls::sysCallsOpen)> mockOpen(&SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int {
+        return 1;
+    });
+
+    VariableBackup<decltype(SysCalls::sysCallsPread)> mockPread(&SysCalls::sysCallsPread, [](int fd, void *buf, size_t count, off_t offset) -> ssize_t {
+        return 0;
+    });
+    EXPECT_EQ(-1, drm.getDeviceNumaNode());
+}
+
+TEST(DrmTest, GivenMalformedNumaNodeSysfsEntryWhenGetDeviceNumaNodeIsCalledThenMinusOneIsReturned) {
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    DrmMock drm{*executionEnvironment->rootDeviceEnvironments[0]};
+
+    drm.setPciPath("device");
+    VariableBackup<decltype(SysCalls::sysCallsOpen)> mockOpen(&SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int {
+        return 1;
+    });
+
+    VariableBackup<decltype(SysCalls::sysCallsPread)> mockPread(&SysCalls::sysCallsPread, [](int fd, void *buf, size_t count, off_t offset) -> ssize_t {
+        const std::string testData("pqr");
+        memcpy(buf, testData.data(), testData.length());
+        return testData.length();
+    });
+    EXPECT_EQ(-1, drm.getDeviceNumaNode());
+}
+
 TEST(DrmTest, givenSysfsNodeReadFailsWithErrnoWhenGetDeviceMemoryMaxClockRateInMhzIsCalledThenReturnError) {
     auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
     DrmMock drm{*executionEnvironment->rootDeviceEnvironments[0]};
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/atomic_bitset.h"
+
+#include "gtest/gtest.h"
+
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+TEST(AtomicBitsetTest, givenAtomicBitsetWhenSettingAndResettingBitsThenStateMatchesStdBitsetSemantics) {
+    AtomicBitset<64> bitset;
+    EXPECT_EQ(64u, bitset.size());
+    EXPECT_FALSE(bitset.any());
+    EXPECT_EQ(0u, bitset.to_ullong());
+
+    bitset.set(3);
+    EXPECT_TRUE(bitset.test(3));
+    EXPECT_FALSE(bitset.test(2));
+    EXPECT_EQ(8u, bitset.to_ulong());
+
+    bitset.reset(3);
+    EXPECT_FALSE(bitset.test(3));
+
+    bitset.set();
+    EXPECT_EQ(std::numeric_limits<uint64_t>::max(), bitset.to_ullong());
+
+    bitset.reset();
+    EXPECT_EQ(0u, bitset.to_ullong());
+}
+
+TEST(AtomicBitsetTest, givenSmallAtomicBitsetWhenSettingAllBitsThenOnlyValidBitsAreSet) {
+    AtomicBitset<4> bitset;
+    bitset.set();
+    EXPECT_EQ(0xfu, bitset.to_ullong());
+
+    bitset.reset();
+    bitset.set(4);
+    EXPECT_FALSE(bitset.test(4));
+    EXPECT_EQ(0u, bitset.to_ullong());
+}
+
+TEST(AtomicBitsetTest, givenMultipleThreadsWhenEachSetsAndResetsOwnBitThenOtherBitsAreNotLost) {
+    constexpr size_t threadsCount = 8;
+    constexpr size_t iterations = 10'000;
+    AtomicBitset<64> bitset;
+
+    std::vector<std::thread> threads;
+    for (size_t threadId = 0; threadId < threadsCount; threadId++) {
+        threads.emplace_back([&bitset, threadId]() {
+            for (size_t i = 0; i < iterations; i++) {
+                bitset.set(threadId);
+                bitset.reset(threadId);
+            }
+            bitset.set(threadId);
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ((1ull << threadsCount) - 1, bitset.to_ullong());
+}
@@ -450,6 +450,81 @@ TEST(FileLogger, givenDisabledLogWhenLogDebugStringCalledThenStringIsNotWrittenT
     EXPECT_EQ(0u, fileLogger.getFileString(testFile).size());
 }
 
+TEST(FileLogger, givenLogFileBufferSizeSetWhenLoggingThenMessagesAreWrittenToFileWhenBufferIsFull) {
+    std::string testFile = "testfile";
+    DebugVariables flags;
+    flags.LogFileBufferSize.set(16);
+    FullyEnabledFileLogger fileLogger(testFile, flags);
+    fileLogger.useRealFiles(false);
+    EXPECT_EQ(16u, fileLogger.getLogFileBufferSize());
+
+    fileLogger.logDebugString(true, "first ");
+    fileLogger.logDebugString(true, "second ");
+    EXPECT_FALSE(fileLogger.wasFileCreated(testFile));
+
+    fileLogger.logDebugString(true, "third ");
+    EXPECT_EQ(std::string("first second third "), fileLogger.getFileString(testFile));
+
+    fileLogger.logDebugString(true, "fourth");
+    EXPECT_EQ(std::string("first second third "), fileLogger.getFileString(testFile));
+
+    fileLogger.flushLogFileBuffer();
+    EXPECT_EQ(std::string("first second third fourth"), fileLogger.getFileString(testFile));
+}
+
+TEST(FileLogger, givenLogFileBufferSizeSetWhenApiCallReturnsErrorThenBufferIsWrittenToFile) {
+    std::string testFile = "testfile";
+    DebugVariables flags;
+    flags.LogApiCalls.set(true);
+    flags.LogFileBufferSize.set(4096);
+    FullyEnabledFileLogger fileLogger(testFile, flags);
+    fileLogger.useRealFiles(false);
+
+    fileLogger.logApiCall("clFunction", true, 0);
+    fileLogger.logApiCall("clFunction", false, 0);
+    EXPECT_FALSE(fileLogger.wasFileCreated(testFile));
+
+    fileLogger.logApiCall("clFunction", false, -5);
+    EXPECT_TRUE(fileLogger.wasFileCreated(testFile));
+    EXPECT_NE(std::string::npos, fileLogger.getFileString(testFile).find("Function Leave (-5): clFunction"));
+}
+
+TEST(FileLogger, givenLogFileBufferLockedWhenTryingToFlushBufferThenBufferIsWrittenOnlyOnceUnlocked) {
+    std::string testFile = "testfile";
+    DebugVariables flags;
+    flags.LogFileBufferSize.set(4096);
+    FullyEnabledFileLogger fileLogger(testFile, flags);
+    fileLogger.useRealFiles(false);
+
+    fileLogger.logDebugString(true, "message");
+    {
+        std::lock_guard<std::mutex> lock(fileLogger.logFileBufferMutex);
+        fileLogger.tryFlushLogFileBuffer();
+        EXPECT_FALSE(fileLogger.wasFileCreated(testFile));
+    }
+
+    fileLogger.tryFlushLogFileBuffer();
+    EXPECT_EQ(std::string("message"), fileLogger.getFileString(testFile));
+}
+
+TEST(FileLogger, givenLogFileBufferSizeNotSetWhenLoggingThenEachMessageIsWrittenToFileImmediately) {
+    std::string testFile = "testfile";
+    DebugVariables flags;
+    FullyEnabledFileLogger fileLogger(testFile, flags);
+    fileLogger.useRealFiles(false);
+    EXPECT_EQ(0u, fileLogger.getLogFileBufferSize());
+
+    fileLogger.logDebugString(true, "first ");
+    EXPECT_EQ(std::string("first "), fileLogger.getFileString(testFile));
+}
+
+TEST(FileLogger, givenDisabledFileLoggerWhenLogFileBufferSizeSetThenBufferingIsNotEnabled) {
+    DebugVariables flags;
+    flags.LogFileBufferSize.set(16);
+    FullyDisabledFileLogger fileLogger(std::string("testfile"), flags);
+    EXPECT_EQ(0u, fileLogger.getLogFileBufferSize());
+}
+
 TEST(AllocationTypeLogging, givenGraphicsAllocationTypeWhenConvertingToStringThenCorrectStringIsReturned) {
     std::string testFile = "testfile";
     DebugVariables flags;
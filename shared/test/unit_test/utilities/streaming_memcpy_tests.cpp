@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/streaming_memcpy.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace CpuIntrinsicsTests {
+extern std::atomic<uint32_t> sfenceCounter;
+} // namespace CpuIntrinsicsTests
+
+TEST(StreamingMemcpyTest, givenUnalignedDestinationAndVariousSizesWhenCopyingThenOnlyDestinationRangeIsWrittenWithSourceData) {
+    constexpr size_t bufferSize = 256;
+    std::vector<uint8_t> src(bufferSize);
+    for (size_t i = 0; i < bufferSize; i++) {
+        src[i] = static_cast<uint8_t>(i * 7 + 1);
+    }
+
+    for (size_t dstOffset = 0; dstOffset < 17; dstOffset++) {
+        for (size_t size = 0; size < 100; size++) {
+            std::vector<uint8_t> dst(bufferSize, 0);
+            NEO::streamingMemcpy(dst.data() + dstOffset, src.data() + 3, size);
+
+            for (size_t i = 0; i < bufferSize; i++) {
+                uint8_t expected = (i >= dstOffset && i < dstOffset + size) ? src[3 + i - dstOffset] : 0;
+                ASSERT_EQ(expected, dst[i]) << "dstOffset: " << dstOffset << " size: " << size << " index: " << i;
+            }
+        }
+    }
+}
+
+TEST(StreamingMemcpyTest, whenCopyingThenStoresAreFenced) {
+    uint8_t src[64] = {1};
+    alignas(16) uint8_t dst[64] = {};
+
+    auto sfenceCountBefore = CpuIntrinsicsTests::sfenceCounter.load();
+    NEO::streamingMemcpy(dst, src, sizeof(src));
+    EXPECT_EQ(sfenceCountBefore + 1, CpuIntrinsicsTests::sfenceCounter.load());
+    EXPECT_EQ(0, memcmp(dst, src, sizeof(src)));
+}